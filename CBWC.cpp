@@ -1,4 +1,7 @@
 /*
+    Optional argument csv or bin: the results are also written as a flat
+    table, cbwc2.csv (cbwc2.tab for bin), see ResultTable.h.
+
     A new version of cumulant calculating.
     Yige Huang on Dec. 22, 2022
     Based on Yu Zhang's code.
@@ -15,8 +18,19 @@
 #include "TGraphErrors.h"
 
 #include "CentDefinition.h"
+#include "ResultTable.h"
+
+int main(int argc, char** argv){
+    ResultTable* table = 0;
+    if (argc > 1) {
+        std::string fmt(argv[1]);
+        if (fmt != "csv" && fmt != "bin") {
+            std::cout << "[ERROR] Table format should be csv or bin, got " << argv[1] << ".\n";
+            return 1;
+        }
+        table = new ResultTable(fmt == "csv" ? "cbwc2.csv" : "cbwc2.tab");
+    }
 
-int main(){
     // CBWC
     const int MaxMult = 2000;
     const int LowEventCut = 5; // to avoid error caused by low event number
@@ -139,6 +153,9 @@ int main(){
                 // set points to graphes
                 tgs[i][j]->SetPoint(k, nPart[k], vSum[i][k]);
                 tgs[i][j]->SetPointError(k, 0.0, eSum[i][k]);
+                if (table){
+                    table->Fill(typeNames[i], cumNames[j], k, vSum[i][k], eSum[i][k], CentEvent[i][k]);
+                }
             }
         }
     }
@@ -156,6 +173,7 @@ int main(){
     }
     tfin->Close();
     tfout->Close();
+    delete table;
 
     std::cout << "[LOG] All done!.\n";
 
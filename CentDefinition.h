@@ -1,3 +1,6 @@
+#ifndef CENTDEFINITION_H
+#define CENTDEFINITION_H
+
 #include <fstream>
 #include <string>
 #include <iostream>
@@ -56,4 +59,15 @@ class CentDefinition{
             }
             return -1;
         }
+
+        int get_min_mult(){
+            // lowest multiplicity with a centrality, get_cent(mult) >= 0 from here on
+            if (!is_set){
+                std::cout << "[Warning] You should read centrality bin edge first.\n";
+                return 0;
+            }
+            return edge[nCent-1] + 1;
+        }
 };
+
+#endif
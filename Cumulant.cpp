@@ -1,5 +1,14 @@
 /*
 
+    Optional argument cent: only the multiplicities covered by cent_edge.txt
+    are read and calculated, the other bins of cum.raw.*.root stay empty.
+    Leave it out to keep every bin, e.g. for cbwc or duoCBWC with other
+    centrality edges.
+
+    Optional argument csv or bin: the raw and CBWC results are also
+    written as flat tables, cum.raw.*.csv and cum.cbwc.*.csv (.tab for bin),
+    see ResultTable.h.
+
     (18.08.2023) new version
     Now use Npart.txt to get Npart bin edge.
 
@@ -15,6 +24,7 @@
 #include <fstream>
 #include <string>
 #include <vector>
+#include <thread>
 
 #include "TString.h"
 #include "TFile.h"
@@ -22,41 +32,65 @@
 #include "TTree.h"
 #include "TGraphErrors.h"
 #include "ECorr.h"
+#include "MultiECorr.h"
 
 #include "NpartLoader.h"
 #include "CentDefinition.h"
+#include "ResultTable.h"
 
 int main(int argc, char** argv){
 
+    // flat result tables and the centrality range, optional
+    ResultTable* rawTable = 0;
+    ResultTable* cbwcTable = 0;
+    bool centRange = false;
+    for (int i=2; i<argc; i++) {
+        std::string opt(argv[i]);
+        if (opt == "cent") {
+            centRange = true;
+            continue;
+        }
+        if (opt != "csv" && opt != "bin") {
+            std::cout << "[ERROR] Option should be cent, csv or bin, got " << argv[i] << ".\n";
+            return 1;
+        }
+        if (rawTable) {
+            continue; // the first table format wins
+        }
+        const char* ext = opt == "csv" ? "csv" : "tab";
+        rawTable = new ResultTable(Form("cum.raw.%s.%s", argv[1], ext));
+        cbwcTable = new ResultTable(Form("cum.cbwc.%s.%s", argv[1], ext));
+    }
+
     // No CBWC
     std::cout << "[LOG] Now calculting No-CBWC results.\n";
     const int MaxMult = 2000;
     const int LowEventCut = 5; // to avoid error caused by low event number
 
+    const int LowMultCut = 1;
+    CentDefinition* cDef = new CentDefinition();
+    cDef->read_edge("./cent_edge.txt"); // need to prepare a centrality edge text file in the calculating directory
+
     std::cout << "[LOG] Initializing cumulant calculating utils.\n";
-    ECorr* ecp = new ECorr("Pro", MaxMult, LowEventCut); 
-    ECorr* eca = new ECorr("Pbar", MaxMult, LowEventCut); 
-    ECorr* ecn = new ECorr("Netp", MaxMult, LowEventCut); 
-    ecp->Init();
-    ecp->ReadTerms(Form("%s.root", argv[1]));
-    ecp->Calculate();
-    ecp->Update(Form("cum.raw.%s.root", argv[1]));
-    eca->Init();
-    eca->ReadTerms(Form("%s.root", argv[1]));
-    eca->Calculate();
-    eca->Update(Form("cum.raw.%s.root", argv[1]));
-    ecn->Init();
-    ecn->ReadTerms(Form("%s.root", argv[1]));
-    ecn->Calculate();
-    ecn->Update(Form("cum.raw.%s.root", argv[1]));
+    MultiECorr* ec = new MultiECorr(MaxMult, LowEventCut); // Pro, Pbar and Netp
+    if (centRange) {
+        // only the multiplicities used by CBWC are read and calculated
+        ec->SetMultRange(*cDef, LowMultCut);
+    }
+    ec->Init();
+    if (!ec->ReadTerms(Form("%s.root", argv[1]))) { // opened and scanned once for all three
+        std::cout << "[ERROR] Cannot read the terms of " << argv[1] << ".root, see above.\n";
+        return 1;
+    }
+    int nThreads = std::thread::hardware_concurrency();
+    ec->Calculate(nThreads > 0 ? nThreads : 1); // multiplicity bins in parallel
+    ec->Save(Form("cum.raw.%s.root", argv[1]));
 
     std::cout << "[LOG] No-CBWC results done, please check raw.root.\n";
     
     // CBWC
     std::cout << "[LOG] Now applying CBWC.\n";
     const int nCent = 9;
-    CentDefinition* cDef = new CentDefinition();
-    cDef->read_edge("./cent_edge.txt"); // need to prepare a centrality edge text file in the calculating directory
     // int nPart[nCent] = {340, 289, 225, 160, 110, 73, 46, 27, 15};
     TFile* tfin = new TFile(Form("cum.raw.%s.root", argv[1]));
     NpartLoader* nDef = new NpartLoader();
@@ -99,7 +133,6 @@ int main(int argc, char** argv){
         }
     }
 
-    const int LowMultCut = 1;
     double CentEvent[nType][nCent] = {0};
     double vSum[nType][nCent]; // value 
     double eSum[nType][nCent]; // error 
@@ -110,6 +143,24 @@ int main(int argc, char** argv){
         tfin->GetObject(Form("%shEntries", typeNames[i]), hEntries[i]);
     }
 
+    // raw results of every calculated multiplicity, in or out of the centrality edges
+    if (rawTable){
+        for (int i=0; i<nType; i++){
+            for (int j=0; j<nCums; j++){
+                if (i == 2 && j >= 11){
+                    continue;
+                }
+                for (int k=LowMultCut; k<=MaxMult; k++){
+                    int nEvents = hEntries[i]->GetBinContent(k+1);
+                    if (nEvents < LowEventCut){
+                        continue; // not calculated
+                    }
+                    rawTable->Fill(typeNames[i], cumNames[j], k, sCums[i][j]->GetBinContent(k+1), sCums[i][j]->GetBinError(k+1), nEvents);
+                }
+            }
+        }
+    }
+
     for (int i=0; i<nType; i++){ // i for proton types
         for (int j=0; j<nCums; j++){ // j for cumulant orders
             if (i == 2 && j >= 11){ // as well, skip kappa for net proton
@@ -174,6 +225,9 @@ int main(int argc, char** argv){
                 // set points to graphes
                 tgs[i][j]->SetPoint(k, nPart[k], vSum[i][k]);
                 tgs[i][j]->SetPointError(k, 0.0, eSum[i][k]);
+                if (cbwcTable){
+                    cbwcTable->Fill(typeNames[i], cumNames[j], k, vSum[i][k], eSum[i][k], CentEvent[i][k]);
+                }
             }
         }
     }
@@ -191,6 +245,10 @@ int main(int argc, char** argv){
     }
     tfin->Close();
     tfout->Close();
+    if (rawTable){
+        delete rawTable;
+        delete cbwcTable;
+    }
 
     std::cout << "[LOG] All done!.\n";
 
@@ -0,0 +1,596 @@
+#include <iostream>
+#include <cmath>
+#include <thread>
+#include <atomic>
+
+#include "TFile.h"
+#include "TH1D.h"
+#include "TProfile.h"
+#include "ECorr.h"
+#include "TermFile.h"
+#include "CentDefinition.h"
+
+//Calculate works on blocks of m multiplicity bins: every quantity is a
+//column of m values, contiguous, and the formulas below are loops over
+//the bins of the block.
+struct Columns {
+  int m;
+  std::vector<Double_t> data;
+  Columns(int nCol, int m) : m(m), data((size_t)nCol*m, 0) {}
+  Double_t* operator[](int c) { return &data[(size_t)c*m]; }
+};
+
+//Moments -> cumulants: C_k = M_k - sum_{j<k} binom(k-1,j-1) C_j M_{k-j}
+//and the derivatives J[k*(n+1)+l] = dC_k/dM_l, all indices from 1 to n.
+static void CumulantFromMoments(int n, Columns& M, Columns& C, Columns& J){
+  const int m = M.m;
+  std::vector<std::vector<Double_t> > binom(n+1, std::vector<Double_t>(n+1, 0));
+  for(int k=0; k<=n; ++k){
+    binom[k][0] = 1;
+    for(int j=1; j<=k; ++j){
+      binom[k][j] = binom[k-1][j-1] + (j < k ? binom[k-1][j] : 0);
+    }
+  }
+  for(int k=1; k<=n; ++k){
+    Double_t* ck = C[k];
+    const Double_t* mk = M[k];
+    for(int a=0; a<m; ++a){
+      ck[a] = mk[a];
+    }
+    for(int l=1; l<=n; ++l){
+      Double_t* jkl = J[k*(n+1)+l];
+      for(int a=0; a<m; ++a){
+        jkl[a] = (k == l) ? 1 : 0;
+      }
+    }
+    for(int j=1; j<k; ++j){
+      const Double_t b = binom[k-1][j-1];
+      const Double_t* cj = C[j];
+      const Double_t* mkj = M[k-j];
+      for(int a=0; a<m; ++a){
+        ck[a] -= b * cj[a] * mkj[a];
+      }
+      for(int l=1; l<=n; ++l){
+        Double_t* jkl = J[k*(n+1)+l];
+        const Double_t* jjl = J[j*(n+1)+l];
+        for(int a=0; a<m; ++a){
+          jkl[a] -= b * jjl[a] * mkj[a];
+        }
+      }
+      Double_t* jkkj = J[k*(n+1)+k-j];
+      for(int a=0; a<m; ++a){
+        jkkj[a] -= b * cj[a];
+      }
+    }
+  }
+}
+
+//delta theorem: var(f) = grad^T V grad, V the covariance of the moments,
+//grad in the columns g, g+1, ..., g+n-1 of G
+static void PropagateError(int n, Columns& G, int g, Columns& V, Double_t* error){
+  const int m = G.m;
+  for(int a=0; a<m; ++a){
+    error[a] = 0;
+  }
+  for(int k=1; k<=n; ++k){
+    const Double_t* gk = G[g+k-1];
+    for(int l=1; l<=n; ++l){
+      const Double_t* gl = G[g+l-1];
+      const Double_t* vkl = V[k*(n+1)+l];
+      for(int a=0; a<m; ++a){
+        error[a] += gk[a] * gl[a] * vkl[a];
+      }
+    }
+  }
+  for(int a=0; a<m; ++a){
+    error[a] = sqrt(fabs(error[a]));
+  }
+}
+
+//f = x_i / x_j, J the derivatives of x, left at 0 where x_j == 0
+static void SetRatio(int n, Columns& X, Columns& J, int i, int j, Columns& V, Columns& grad, Double_t* value, Double_t* error){
+  const int m = X.m;
+  const Double_t* xi = X[i];
+  const Double_t* xj = X[j];
+  for(int l=1; l<=n; ++l){
+    const Double_t* ji = J[i*(n+1)+l];
+    const Double_t* jj = J[j*(n+1)+l];
+    Double_t* gl = grad[l-1];
+    for(int a=0; a<m; ++a){
+      gl[a] = xj[a] == 0 ? 0 : ji[a] / xj[a] - xi[a] * jj[a] / (xj[a]*xj[a]);
+    }
+  }
+  PropagateError(n, grad, 0, V, error);
+  for(int a=0; a<m; ++a){
+    value[a] = xj[a] == 0 ? 0 : xi[a] / xj[a];
+  }
+}
+
+ECorr::ECorr(const char* type, int MaxMult, int LowEventCut, int MaxOrder) : _nMultBin(MaxMult+1), ParticleType(type), LowEventCut(LowEventCut), _spec(MaxOrder){
+  _nTerms = _spec.GetNTerms();
+  _file = 0;
+  _fromFile = false;
+  _termsRead = false;
+  _haveTerm.assign(_nTerms, false);
+  _lowBin = 1;
+  _highBin = _nMultBin;
+  hEntries = 0;
+  for(int i=0; i<TermSpec::kMaxOrder; ++i){
+    _sM[i] = 0;
+    _sC[i] = 0;
+    _sk[i] = 0;
+  }
+  _sR21 = _sR32 = _sR42 = _sR51 = _sR62 = _sR71 = _sR82 = 0;
+  _sk21 = _sk31 = _sk41 = _sk51 = _sk61 = _sk71 = _sk81 = 0;
+}
+
+ECorr::~ECorr(){
+  delete _file;
+  for(size_t i=0; i<_hists.size(); ++i){
+    delete _hists[i];
+  }
+}
+
+void ECorr::Init(){
+  TH1D** hists[] = {
+    &hEntries,
+    &_sM[0], &_sM[1], &_sM[2], &_sM[3], &_sM[4], &_sM[5], &_sM[6], &_sM[7],
+    &_sC[0], &_sC[1], &_sC[2], &_sC[3], &_sC[4], &_sC[5], &_sC[6], &_sC[7],
+    &_sR21, &_sR32, &_sR42, &_sR51, &_sR62, &_sR71, &_sR82,
+    &_sk[0], &_sk[1], &_sk[2], &_sk[3], &_sk[4], &_sk[5], &_sk[6], &_sk[7],
+    &_sk21, &_sk31, &_sk41, &_sk51, &_sk61, &_sk71, &_sk81
+  };
+  const char* names[] = {
+    "hEntries",
+    "M1", "M2", "M3", "M4", "M5", "M6", "M7", "M8",
+    "C1", "C2", "C3", "C4", "C5", "C6", "C7", "C8",
+    "R21", "R32", "R42", "R51", "R62", "R71", "R82",
+    "k1", "k2", "k3", "k4", "k5", "k6", "k7", "k8",
+    "k21", "k31", "k41", "k51", "k61", "k71", "k81"
+  };
+  //order needed by each histogram, the ones above MaxOrder are not made
+  const int orders[] = {
+    0,
+    1, 2, 3, 4, 5, 6, 7, 8,
+    1, 2, 3, 4, 5, 6, 7, 8,
+    2, 3, 4, 5, 6, 7, 8,
+    1, 2, 3, 4, 5, 6, 7, 8,
+    2, 3, 4, 5, 6, 7, 8
+  };
+  const int nHists = sizeof(names) / sizeof(names[0]);
+  for(size_t i=0; i<_hists.size(); ++i){
+    delete _hists[i];
+  }
+  _hists.clear();
+  for(int i=0; i<nHists; ++i){
+    *hists[i] = 0;
+    if(orders[i] > _spec.GetMaxOrder()){ continue; }
+    *hists[i] = new TH1D(Form("%s%s", ParticleType, names[i]), "", _nMultBin, -0.5, _nMultBin-0.5);
+    (*hists[i])->SetDirectory(0);
+    _hists.push_back(*hists[i]);
+  }
+}
+
+void ECorr::SetMultRange(int LowMult, int HighMult){
+  //bins outside of the range are not read and stay empty
+  _lowBin = LowMult < 0 ? 1 : LowMult+1;
+  _highBin = HighMult+1 > _nMultBin ? _nMultBin : HighMult+1;
+}
+
+void ECorr::SetMultRange(CentDefinition& cDef, int LowMultCut){
+  //only multiplicities inside a centrality class enter the CBWC
+  int low = cDef.get_min_mult();
+  SetMultRange(low > LowMultCut ? low : LowMultCut, _nMultBin-1);
+}
+
+void ECorr::ClearTerms(){
+  delete _file;
+  _file = 0;
+  _fromFile = false;
+  _termsRead = false;
+  _row.clear();
+  _rowEntries.clear();
+  _rowMeans.clear();
+  _haveTerm.assign(_nTerms, false);
+}
+
+void ECorr::ReadTerms(const char* FileName){
+  ClearTerms();
+  if(TermFile::IsTermFile(FileName)){
+    _file = new TermFile(FileName);
+    if(_file->IsOpen()){
+      ReadSection(*_file, FileName);
+    }
+    return;
+  }
+  TFile* tf = new TFile(FileName);
+  if(tf->IsZombie()){
+    std::cout << "[ERROR] Cannot open terms file " << FileName << ".\n";
+    delete tf;
+    return;
+  }
+  for(int i=0; i<_nTerms; ++i){
+    TProfile* p = 0;
+    tf->GetObject(Form("%s_%s", ParticleType, _spec.GetName(i)), p);
+    if(!p){ break; }
+    ReadProfile(i, p);
+    delete p;
+  }
+  CheckTerms(FileName);
+  tf->Close();
+  delete tf;
+}
+
+void ECorr::ReadTerms(const TermFile& file){
+  ClearTerms();
+  ReadSection(file, "the binary terms file");
+}
+
+void ECorr::ReadProfile(int i, const TProfile* p){
+  //keeps the means of the bins in the multiplicity range, the rows are set
+  //up by the first profile, the profile binning may differ from ours (other
+  //MaxMult, or a file with only the populated bins), so look the multiplicities
+  //up, outside of the axis FindFixBin gives the under- or overflow
+  if(_row.empty()){
+    _row.assign(_nMultBin+1, -1);
+    for(int bin=_lowBin; bin<=_highBin; ++bin){
+      int j = p->FindFixBin(bin-1);
+      if(j < 1 || j > p->GetNbinsX() || p->GetBinEntries(j) <= 0){ continue; }
+      _row[bin] = _rowEntries.size();
+      _rowEntries.push_back(p->GetBinEntries(j));
+    }
+    _rowMeans.assign(_rowEntries.size()*_nTerms, 0);
+  }
+  for(int bin=_lowBin; bin<=_highBin; ++bin){
+    if(_row[bin] < 0){ continue; }
+    _rowMeans[(long long)_row[bin]*_nTerms + i] = p->GetBinContent(p->FindFixBin(bin-1));
+  }
+  _haveTerm[i] = true;
+}
+
+bool ECorr::CheckTerms(const char* FileName){
+  //after the ReadProfile calls
+  for(int i=0; i<_nTerms; ++i){
+    if(!_haveTerm[i]){
+      std::cout << "[ERROR] Term " << ParticleType << "_" << _spec.GetName(i) << " is missing in " << FileName << ".\n";
+      return false;
+    }
+  }
+  _termsRead = true;
+  return true;
+}
+
+void ECorr::ReadSection(const TermFile& file, const char* FileName){
+  //the sums stay in the mapped file, only the row and column of every
+  //multiplicity bin and term are looked up here, rows outside of the
+  //multiplicity range are never touched
+  if(!file.FindSection(ParticleType, _section)){
+    std::cout << "[ERROR] No " << ParticleType << " terms in " << FileName << ".\n";
+    return;
+  }
+  _fileTerm.assign(_nTerms, -1);
+  for(int j=0; j<_section.head->nTerms; ++j){
+    int i = _spec.FindTerm(_section.names[j]);
+    if(i >= 0){
+      _fileTerm[i] = j;
+      _haveTerm[i] = true;
+    }
+  }
+  if(!CheckTerms(FileName)){ return; }
+  _row.assign(_nMultBin+1, -1);
+  for(int b=0; b<_section.head->nBins; ++b){
+    long long bin = _section.bin[b]; // bin 1 is mult == 0 in both
+    if(bin >= _lowBin && bin <= _highBin && bin <= _section.head->nMultBin){
+      _row[bin] = b;
+    }
+  }
+  _fromFile = true;
+}
+
+Double_t ECorr::ReadEntries(int bin) const {
+  //number of events in the bin
+  int row = _row[bin];
+  if(row < 0){ return 0; }
+  return _fromFile ? _section.entries[row] : _rowEntries[row];
+}
+
+void ECorr::ReadMeans(int bin, Double_t* mean, long long stride) const {
+  //mean of every term to mean[i*stride], the bin must have events
+  int row = _row[bin];
+  if(_fromFile){
+    Double_t nEvents = _section.entries[row];
+    const double* sums = _section.sums + (long long)row*_section.head->nTerms*2;
+    for(int i=0; i<_nTerms; ++i){
+      mean[i*stride] = sums[2*_fileTerm[i]] / nEvents;
+    }
+    return;
+  }
+  const Double_t* means = &_rowMeans[(long long)row*_nTerms];
+  for(int i=0; i<_nTerms; ++i){
+    mean[i*stride] = means[i];
+  }
+}
+
+//ratios C_a / C_b and k_a / k_b, made when a <= MaxOrder, see Init
+static const int nRatio = 7;
+static const int ratioC[nRatio][2] = {{2, 1}, {3, 2}, {4, 2}, {5, 1}, {6, 2}, {7, 1}, {8, 2}};
+static const int ratioK[nRatio][2] = {{2, 1}, {3, 1}, {4, 1}, {5, 1}, {6, 1}, {7, 1}, {8, 1}};
+
+void ECorr::Calculate(int nThreads){
+  std::vector<ECorr*> ecorr(1, this);
+  std::vector<Job> jobs(1);
+  if(!Prepare(jobs[0])){ return; }
+  Run(ecorr, jobs, nThreads);
+  Finish(jobs[0]);
+}
+
+bool ECorr::Prepare(Job& job){
+  //output histograms and the bins with enough events, false if nothing to do
+  const int n = _spec.GetMaxOrder();
+  if(!_termsRead){
+    std::cout << "[ERROR] Terms of " << ParticleType << " are not read, nothing to calculate.\n";
+    return false;
+  }
+
+  //output histograms, in the order CalculateBlock fills its columns
+  std::vector<TH1D*>& outs = job.outs;
+  TH1D* hRatioC[nRatio] = {_sR21, _sR32, _sR42, _sR51, _sR62, _sR71, _sR82};
+  TH1D* hRatioK[nRatio] = {_sk21, _sk31, _sk41, _sk51, _sk61, _sk71, _sk81};
+  outs.clear();
+  outs.insert(outs.end(), _sM, _sM+n);
+  outs.insert(outs.end(), _sC, _sC+n);
+  for(int r=0; r<nRatio; ++r){
+    if(ratioC[r][0] <= n){ outs.push_back(hRatioC[r]); }
+  }
+  outs.insert(outs.end(), _sk, _sk+n);
+  for(int r=0; r<nRatio; ++r){
+    if(ratioK[r][0] <= n){ outs.push_back(hRatioK[r]); }
+  }
+
+  //bins with enough events, they are calculated in blocks of kBlock: the
+  //mean of term i over the bins of a block is one contiguous column, and
+  //every output is a column over all of these bins
+  job.bins.clear();
+  job.entries.clear();
+  for(int bin=_lowBin; bin<=_highBin; ++bin){
+    Double_t nEvents = ReadEntries(bin);
+    hEntries->SetBinContent(bin, nEvents);
+    if(nEvents < LowEventCut || nEvents <= 0){ continue; }
+    job.bins.push_back(bin);
+    job.entries.push_back(nEvents);
+  }
+  const int nAct = job.bins.size();
+  job.value.assign(outs.size()*nAct, 0);
+  job.error.assign(outs.size()*nAct, 0);
+  job.nBlocks = (nAct + kBlock - 1) / kBlock;
+  return nAct > 0;
+}
+
+void ECorr::RunBlock(Job& job, int block, std::vector<Double_t>& mean) const {
+  //block of kBlock bins, into its part of the output columns
+  const int nAct = job.bins.size();
+  const int first = block*kBlock;
+  const int m = nAct-first < kBlock ? nAct-first : kBlock;
+  mean.resize((size_t)_nTerms*kBlock);
+  for(int a=0; a<m; ++a){
+    ReadMeans(job.bins[first+a], &mean[a], m);
+  }
+  CalculateBlock(&mean[0], m, &job.entries[first], m, &job.value[first], &job.error[first], nAct);
+}
+
+void ECorr::Run(const std::vector<ECorr*>& ecorr, std::vector<Job>& jobs, int nThreads){
+  //the blocks of all jobs go to one pool of threads, each thread takes the
+  //next block with its own term columns, so the memory does not grow with
+  //the number of bins (22531 terms at order 8); the blocks are independent,
+  //the results do not depend on which thread did which
+  std::vector<std::pair<int, int> > tasks; // (job, block)
+  for(size_t j=0; j<jobs.size(); ++j){
+    for(int b=0; b<jobs[j].nBlocks; ++b){
+      tasks.push_back(std::make_pair(j, b));
+    }
+  }
+  if(nThreads < 1){ nThreads = 1; }
+  if(nThreads > (int)tasks.size()){ nThreads = tasks.size(); }
+  std::atomic<int> next(0);
+  std::vector<std::thread> workers;
+  for(int t=0; t<nThreads; ++t){
+    workers.push_back(std::thread([&](){
+      std::vector<Double_t> mean;
+      for(int i=next++; i<(int)tasks.size(); i=next++){
+        ecorr[tasks[i].first]->RunBlock(jobs[tasks[i].first], tasks[i].second, mean);
+      }
+    }));
+  }
+  for(int t=0; t<nThreads; ++t){
+    workers[t].join();
+  }
+}
+
+void ECorr::Finish(const Job& job){
+  //the histograms are only touched here, by the calling thread
+  const int nAct = job.bins.size();
+  for(size_t o=0; o<job.outs.size(); ++o){
+    for(int a=0; a<nAct; ++a){
+      job.outs[o]->SetBinContent(job.bins[a], job.value[o*nAct+a]);
+      job.outs[o]->SetBinError(job.bins[a], job.error[o*nAct+a]);
+    }
+  }
+}
+
+void ECorr::CalculateBlock(const Double_t* mean, long long stride, const Double_t* nEvents, int m, Double_t* value, Double_t* error, long long ostride) const {
+  //m bins, the mean of term i at mean[i*stride + a], output o to
+  //value[o*ostride + a] and error[o*ostride + a], o in the order of the
+  //histograms in Calculate
+  const int n = _spec.GetMaxOrder();
+  const int nn = (n+1)*(n+1);
+  Columns M(n+1, m), C(n+1, m), F(n+1, m), K(n+1, m);
+  Columns V(nn, m), JC(nn, m), JF(nn, m), JK(nn, m);
+  Columns grad(n, m);
+  int o = 0;
+
+  //factorial moments F_k = sum_l s(k,l) M_l, s the signed Stirling numbers of the first kind
+  std::vector<std::vector<Double_t> > stirling(n+1, std::vector<Double_t>(n+1, 0));
+  stirling[0][0] = 1;
+  for(int k=1; k<=n; ++k){
+    for(int l=1; l<=k; ++l){
+      stirling[k][l] = stirling[k-1][l-1] - (k-1)*stirling[k-1][l];
+    }
+  }
+
+  //moments and their covariance matrix, cov(M_k, M_l) = (<M_k M_l> - M_k M_l) / N
+  for(int k=1; k<=n; ++k){
+    const std::vector<std::pair<int, double> >& mk = _spec.GetMoment(k);
+    Double_t* Mk = M[k];
+    for(size_t i=0; i<mk.size(); ++i){
+      const Double_t c = mk[i].second;
+      const Double_t* x = mean + _spec.GetBasisTerm(mk[i].first)*stride;
+      for(int a=0; a<m; ++a){
+        Mk[a] += c * x[a];
+      }
+    }
+  }
+  for(int k=1; k<=n; ++k){
+    for(int l=k; l<=n; ++l){
+      //sparse dot product with the table of TermSpec, the pairs of basis
+      //entries are already collected by product term
+      const std::vector<std::pair<int, double> >& mkl = _spec.GetMomentProduct(k, l);
+      Double_t* cov = V[k*(n+1)+l];
+      for(size_t i=0; i<mkl.size(); ++i){
+        const Double_t c = mkl[i].second;
+        const Double_t* x = mean + mkl[i].first*stride;
+        for(int a=0; a<m; ++a){
+          cov[a] += c * x[a];
+        }
+      }
+      const Double_t* Mk = M[k];
+      const Double_t* Ml = M[l];
+      Double_t* cov2 = V[l*(n+1)+k];
+      for(int a=0; a<m; ++a){
+        cov[a] = (cov[a] - Mk[a] * Ml[a]) / nEvents[a];
+        cov2[a] = cov[a];
+      }
+    }
+  }
+
+  //moments and cumulants
+  for(int k=1; k<=n; ++k, ++o){
+    const Double_t* Mk = M[k];
+    const Double_t* vkk = V[k*(n+1)+k];
+    for(int a=0; a<m; ++a){
+      value[o*ostride+a] = Mk[a];
+      error[o*ostride+a] = sqrt(fabs(vkk[a]));
+    }
+  }
+  CumulantFromMoments(n, M, C, JC);
+  for(int k=1; k<=n; ++k, ++o){
+    PropagateError(n, JC, k*(n+1)+1, V, error + o*ostride);
+    const Double_t* Ck = C[k];
+    for(int a=0; a<m; ++a){
+      value[o*ostride+a] = Ck[a];
+    }
+  }
+  for(int r=0; r<nRatio; ++r){
+    if(ratioC[r][0] > n){ continue; }
+    SetRatio(n, C, JC, ratioC[r][0], ratioC[r][1], V, grad, value + o*ostride, error + o*ostride);
+    ++o;
+  }
+
+  //factorial cumulants, from the factorial moments in the same way
+  for(int k=1; k<=n; ++k){
+    Double_t* Fk = F[k];
+    for(int l=1; l<=k; ++l){
+      const Double_t s = stirling[k][l];
+      const Double_t* Ml = M[l];
+      for(int a=0; a<m; ++a){
+        Fk[a] += s * Ml[a];
+      }
+    }
+  }
+  CumulantFromMoments(n, F, K, JF);
+  for(int k=1; k<=n; ++k){
+    for(int l=1; l<=n; ++l){
+      Double_t* jkl = JK[k*(n+1)+l];
+      for(int j=l; j<=n; ++j){
+        const Double_t s = stirling[j][l];
+        const Double_t* jfkj = JF[k*(n+1)+j];
+        for(int a=0; a<m; ++a){
+          jkl[a] += jfkj[a] * s;
+        }
+      }
+    }
+  }
+  for(int k=1; k<=n; ++k, ++o){
+    PropagateError(n, JK, k*(n+1)+1, V, error + o*ostride);
+    const Double_t* Kk = K[k];
+    for(int a=0; a<m; ++a){
+      value[o*ostride+a] = Kk[a];
+    }
+  }
+  for(int r=0; r<nRatio; ++r){
+    if(ratioK[r][0] > n){ continue; }
+    SetRatio(n, K, JK, ratioK[r][0], ratioK[r][1], V, grad, value + o*ostride, error + o*ostride);
+    ++o;
+  }
+}
+
+void ECorr::Write(TDirectory* out){
+  out->cd();
+  for(size_t i=0; i<_hists.size(); ++i){
+    _hists[i]->Write();
+  }
+}
+
+void ECorr::Write(const char* OutName, const char* option){
+  TFile* out = new TFile(OutName, option);
+  Write(out);
+  out->Close();
+  delete out;
+}
+
+void ECorr::Save(const char* OutName){
+  Write(OutName, "recreate");
+}
+
+void ECorr::Update(const char* OutName){
+  Write(OutName, "update");
+}
+
+TH1D* ECorr::GetCumulant(int Order){
+  if(Order < 1 || Order > _spec.GetMaxOrder()){ return 0; }
+  return _sC[Order-1];
+}
+
+TH1D* ECorr::GetCumulantRatio(int RatioName){
+  switch(RatioName){
+    case 21: return _sR21;
+    case 32: return _sR32;
+    case 42: return _sR42;
+    case 51: return _sR51;
+    case 62: return _sR62;
+    case 71: return _sR71;
+    case 82: return _sR82;
+  }
+  return 0;
+}
+
+TH1D* ECorr::GetFactorialCumulant(int Order){
+  if(Order < 1 || Order > _spec.GetMaxOrder()){ return 0; }
+  return _sk[Order-1];
+}
+
+TH1D* ECorr::GetFactorialCumulantRatio(int RatioName){
+  switch(RatioName){
+    case 21: return _sk21;
+    case 31: return _sk31;
+    case 41: return _sk41;
+    case 51: return _sk51;
+    case 61: return _sk61;
+    case 71: return _sk71;
+    case 81: return _sk81;
+  }
+  return 0;
+}
+
+TH1D* ECorr::GetEntriesHistogram(){
+  return hEntries;
+}
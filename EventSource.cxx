@@ -0,0 +1,255 @@
+#include "EventSource.h"
+
+#include <iostream>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "TFile.h"
+#include "TTree.h"
+
+void EventBatch::Clear(){
+  mult.clear();
+  first.assign(1, 0);
+  charge.clear();
+  eff.clear();
+}
+
+EventSource* EventSource::Open(const char* FileName){
+  char magic[8];
+  FILE* f = fopen(FileName, "rb");
+  if(!f){
+    std::cout << "[ERROR] Cannot open event file " << FileName << ".\n";
+    return 0;
+  }
+  bool ok = fread(magic, 1, 8, f) == 8;
+  fclose(f);
+  EventSource* src = 0;
+  if(ok && memcmp(magic, PackedSource::Magic(), 8) == 0){
+    src = new PackedSource(FileName);
+  } else if(ok && memcmp(magic, ColumnSource::Magic(), 8) == 0){
+    src = new ColumnSource(FileName);
+  } else {
+    src = new TreeSource(FileName);
+  }
+  if(!src->IsOpen()){
+    delete src;
+    return 0;
+  }
+  return src;
+}
+
+TreeSource::TreeSource(const char* FileName) : _tree(0), _entry(0), _nEntries(0){
+  _file = new TFile(FileName);
+  if(_file->IsZombie()){
+    std::cout << "[ERROR] Cannot open event file " << FileName << ".\n";
+    return;
+  }
+  _file->GetObject("events", _tree);
+  if(!_tree){
+    std::cout << "[ERROR] No TTree events in " << FileName << ".\n";
+    return;
+  }
+  _tree->SetBranchStatus("*", 0);
+  const char* branches[] = {"RefMult", "nTrack", "charge", "eff"};
+  for(int i=0; i<4; ++i){
+    _tree->SetBranchStatus(branches[i], 1);
+  }
+  //GetEntry writes nTrack floats into the buffers before we can check it
+  int maxTrack = (int)_tree->GetMaximum("nTrack");
+  _charge.assign(maxTrack > 0 ? maxTrack : 1, 0);
+  _eff.assign(maxTrack > 0 ? maxTrack : 1, 0);
+  _tree->SetBranchAddress("RefMult", &_mult);
+  _tree->SetBranchAddress("nTrack", &_nTrack);
+  _tree->SetBranchAddress("charge", &_charge[0]);
+  _tree->SetBranchAddress("eff", &_eff[0]);
+  _tree->SetCacheSize(64*1024*1024);
+  _nEntries = _tree->GetEntries();
+}
+
+TreeSource::~TreeSource(){
+  if(_file){
+    _file->Close();
+  }
+  delete _file;
+}
+
+int TreeSource::ReadBatch(EventBatch& batch, int n){
+  batch.Clear();
+  for(; _entry<_nEntries && batch.GetNEvents()<n; ++_entry){
+    _tree->GetEntry(_entry);
+    int nTrack = _nTrack;
+    batch.mult.push_back(_mult);
+    batch.charge.insert(batch.charge.end(), _charge.begin(), _charge.begin()+nTrack);
+    batch.eff.insert(batch.eff.end(), _eff.begin(), _eff.begin()+nTrack);
+    batch.first.push_back(batch.charge.size());
+  }
+  return batch.GetNEvents();
+}
+
+ColumnSource::ColumnSource(const char* FileName) : _nEvents(0), _event(0){
+  for(int i=0; i<nColumn; ++i){
+    _in[i] = 0;
+  }
+  ColumnHeader head;
+  FILE* in = fopen(FileName, "rb");
+  if(!in || fread(&head, sizeof(head), 1, in) != 1){
+    std::cout << "[ERROR] Cannot read event file " << FileName << ".\n";
+    if(in){ fclose(in); }
+    return;
+  }
+  _nEvents = head.nEvents;
+  long long start[nColumn];
+  start[0] = sizeof(head);
+  start[1] = start[0] + head.nEvents*sizeof(int);
+  start[2] = start[1] + head.nEvents*sizeof(int);
+  start[3] = start[2] + head.nTracks*sizeof(float);
+  _in[0] = in;
+  for(int i=1; i<nColumn; ++i){
+    _in[i] = fopen(FileName, "rb");
+  }
+  for(int i=0; i<nColumn; ++i){
+    if(!_in[i] || fseek(_in[i], start[i], SEEK_SET) != 0){
+      std::cout << "[ERROR] Cannot read event file " << FileName << ".\n";
+      for(int j=0; j<nColumn; ++j){
+        if(_in[j]){ fclose(_in[j]); }
+        _in[j] = 0;
+      }
+      return;
+    }
+  }
+}
+
+ColumnSource::~ColumnSource(){
+  for(int i=0; i<nColumn; ++i){
+    if(_in[i]){ fclose(_in[i]); }
+  }
+}
+
+int ColumnSource::ReadBatch(EventBatch& batch, int n){
+  batch.Clear();
+  long long nEvents = _nEvents - _event < n ? _nEvents - _event : n;
+  if(nEvents <= 0){ return 0; }
+  std::vector<int> nTrack(nEvents);
+  batch.mult.resize(nEvents);
+  if(fread(&batch.mult[0], sizeof(int), nEvents, _in[0]) != (size_t)nEvents || fread(&nTrack[0], sizeof(int), nEvents, _in[1]) != (size_t)nEvents){
+    std::cout << "[ERROR] Event file is truncated.\n";
+    batch.Clear();
+    _event = _nEvents;
+    return 0;
+  }
+  batch.first.resize(nEvents+1);
+  for(long long e=0; e<nEvents; ++e){
+    batch.first[e+1] = batch.first[e] + nTrack[e];
+  }
+  long long nTracks = batch.first[nEvents];
+  batch.charge.resize(nTracks);
+  batch.eff.resize(nTracks);
+  if(nTracks > 0 && (fread(&batch.charge[0], sizeof(float), nTracks, _in[2]) != (size_t)nTracks || fread(&batch.eff[0], sizeof(float), nTracks, _in[3]) != (size_t)nTracks)){
+    std::cout << "[ERROR] Event file is truncated.\n";
+    batch.Clear();
+    _event = _nEvents;
+    return 0;
+  }
+  _event += nEvents;
+  return nEvents;
+}
+
+PackedSource::PackedSource(const char* FileName) : _data(0), _size(0), _begin(0), _end(0), _nEvents(0), _cur(0){
+  int fd = open(FileName, O_RDONLY);
+  if(fd < 0){
+    std::cout << "[ERROR] Cannot open event file " << FileName << ".\n";
+    return;
+  }
+  struct stat st;
+  if(fstat(fd, &st) == 0 && st.st_size >= (long long)sizeof(PackedHeader)){
+    void* p = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(p != MAP_FAILED){
+      _data = (const char*)p;
+      _size = st.st_size;
+    }
+  }
+  close(fd);
+  if(!_data){
+    std::cout << "[ERROR] Cannot map event file " << FileName << ".\n";
+    return;
+  }
+  madvise((void*)_data, _size, MADV_SEQUENTIAL);
+  _nEvents = ((const PackedHeader*)_data)->nEvents;
+  _begin = _data + sizeof(PackedHeader);
+  _end = _data + _size;
+  _cur = _begin;
+}
+
+PackedSource::~PackedSource(){
+  if(_data){
+    munmap((void*)_data, _size);
+  }
+}
+
+bool PackedSource::Next(const char*& ev, int& mult, int& nTrack, const float*& pairs) const {
+  //reads the event at ev and moves ev to the next one, false at the end
+  if(!ev || ev + 2*sizeof(int) > _end){ return false; }
+  const int* head = (const int*)ev;
+  mult = head[0];
+  nTrack = head[1];
+  pairs = (const float*)(head + 2);
+  const char* next = (const char*)(pairs + 2*(long long)nTrack);
+  if(nTrack < 0 || next > _end){
+    std::cout << "[ERROR] Event file is truncated.\n";
+    ev = _end;
+    return false;
+  }
+  ev = next;
+  return true;
+}
+
+int PackedSource::ReadBatch(EventBatch& batch, int n){
+  batch.Clear();
+  int mult, nTrack;
+  const float* pairs;
+  while(batch.GetNEvents() < n && Next(_cur, mult, nTrack, pairs)){
+    batch.mult.push_back(mult);
+    for(int i=0; i<nTrack; ++i){
+      batch.charge.push_back(pairs[2*i]);
+      batch.eff.push_back(pairs[2*i+1]);
+    }
+    batch.first.push_back(batch.charge.size());
+  }
+  return batch.GetNEvents();
+}
+
+long long PackedSource::Write(const char* FileName, EventSource& src){
+  FILE* out = fopen(FileName, "wb");
+  if(!out){
+    std::cout << "[ERROR] Cannot write event file " << FileName << ".\n";
+    return 0;
+  }
+  PackedHeader head;
+  memset(&head, 0, sizeof(head));
+  memcpy(head.magic, Magic(), 8);
+  fwrite(&head, sizeof(head), 1, out);
+  EventBatch batch;
+  std::vector<float> pairs;
+  while(src.ReadBatch(batch, 1 << 16) > 0){
+    for(int e=0; e<batch.GetNEvents(); ++e){
+      int evHead[2] = {batch.mult[e], (int)(batch.first[e+1] - batch.first[e])};
+      pairs.resize(2*evHead[1]);
+      for(int i=0; i<evHead[1]; ++i){
+        pairs[2*i] = batch.charge[batch.first[e]+i];
+        pairs[2*i+1] = batch.eff[batch.first[e]+i];
+      }
+      fwrite(evHead, sizeof(int), 2, out);
+      if(evHead[1] > 0){
+        fwrite(&pairs[0], sizeof(float), pairs.size(), out);
+      }
+    }
+    head.nEvents += batch.GetNEvents();
+  }
+  fseek(out, 0, SEEK_SET);
+  fwrite(&head, sizeof(head), 1, out);
+  fclose(out);
+  return head.nEvents;
+}
@@ -0,0 +1,105 @@
+#ifndef EVENTSOURCE_H
+#define EVENTSOURCE_H
+
+#include <vector>
+#include <cstdio>
+
+class TFile;
+class TTree;
+
+//Events for the fillTerms driver, read in batches: RefMult and the
+//(charge, eff) of every track, charge > 0 proton, < 0 antiproton.
+struct EventBatch {
+  std::vector<int> mult;
+  std::vector<long long> first; // first track of every event, size nEvents+1
+  std::vector<float> charge;
+  std::vector<float> eff;
+  int GetNEvents() const { return mult.size(); }
+  void Clear();
+};
+
+class EventSource {
+
+  public:
+    virtual ~EventSource(){}
+    virtual bool IsOpen() const = 0;
+    virtual int ReadBatch(EventBatch&, int) = 0; // up to n events, returns how many
+    static EventSource* Open(const char*); // by the file content, 0 if it cannot be read
+};
+
+//TTree "events" with int RefMult, int nTrack, float charge[nTrack], float eff[nTrack]
+class TreeSource : public EventSource {
+
+  public:
+    TreeSource(const char*);
+    ~TreeSource();
+    bool IsOpen() const { return _tree != 0; }
+    int ReadBatch(EventBatch&, int);
+
+  private:
+    TFile* _file;
+    TTree* _tree;
+    long long _entry;
+    long long _nEntries;
+    int _mult;
+    int _nTrack;
+    std::vector<float> _charge; // sized for the largest nTrack of the tree
+    std::vector<float> _eff;
+};
+
+//columnar binary file: ColumnHeader, then the columns one after another,
+//int RefMult[nEvents], int nTrack[nEvents], float charge[nTracks], float eff[nTracks]
+struct ColumnHeader {
+  char magic[8]; // "CUMCOL1"
+  long long nEvents;
+  long long nTracks;
+};
+
+class ColumnSource : public EventSource {
+
+  public:
+    ColumnSource(const char*);
+    ~ColumnSource();
+    bool IsOpen() const { return _in[0] != 0; }
+    int ReadBatch(EventBatch&, int);
+    static const char* Magic() { return "CUMCOL1"; }
+
+  private:
+    static const int nColumn = 4;
+    FILE* _in[nColumn]; // one stream per column
+    long long _nEvents;
+    long long _event;
+};
+
+//packed binary file, mapped read-only: PackedHeader, then for every event
+//int RefMult, int nTrack and nTrack (charge, eff) float pairs, walked in
+//place with Next, without any copy
+struct PackedHeader {
+  char magic[8]; // "CUMPACK1"
+  long long nEvents;
+};
+
+class PackedSource : public EventSource {
+
+  public:
+    PackedSource(const char*);
+    ~PackedSource();
+    bool IsOpen() const { return _data != 0; }
+    int ReadBatch(EventBatch&, int);
+    long long GetNEvents() const { return _nEvents; }
+    //const char* ev = Begin(); while(Next(ev, mult, nTrack, pairs)){ ... }
+    const char* Begin() const { return _begin; }
+    bool Next(const char*& ev, int& mult, int& nTrack, const float*& pairs) const;
+    static const char* Magic() { return "CUMPACK1"; }
+    static long long Write(const char*, EventSource&); // converter, returns the events written
+
+  private:
+    const char* _data;
+    long long _size;
+    const char* _begin; // first event
+    const char* _end;
+    long long _nEvents;
+    const char* _cur; // for ReadBatch
+};
+
+#endif
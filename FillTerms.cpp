@@ -0,0 +1,127 @@
+/*
+    Fill the terms of Pro, Pbar and Netp from an event file.
+
+    Input is a TTree "events" (int RefMult, int nTrack, float charge[nTrack],
+    float eff[nTrack]), a columnar or a packed binary file, see EventSource.h.
+    Events are read in batches, every thread fills its MultiLoader shard
+    from the batch (each multiplicity bin belongs to one shard), and the
+    shards are merged at the end, so the output does not depend on the
+    number of threads. A packed file is mapped and every thread walks it
+    in place, without batches.
+    The output is a binary terms file when its name does not end in .root.
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+
+#include "TROOT.h"
+#include "MultiLoader.h"
+#include "EventSource.h"
+
+using std::vector;
+using std::string;
+
+int main(int argc, char** argv){
+    if (argc < 3) {
+        std::cout << "[ERROR] Should have at least 2 arguments!\n";
+        std::cout << " - Usage: ./fillTerms EVENT_FILE OUTNAME [N_THREADS=4] [MAX_MULT=2000] [MAX_ORDER=6]\n";
+        return 1;
+    }
+    const char* inName = argv[1];
+    const char* outName = argv[2];
+    int nThreads = argc > 3 ? atoi(argv[3]) : 4;
+    const int MaxMult = argc > 4 ? atoi(argv[4]) : 2000;
+    const int MaxOrder = argc > 5 ? atoi(argv[5]) : 6;
+    const int BatchSize = 1 << 16; // events per batch
+    if (nThreads < 1) {
+        nThreads = 1;
+    }
+    ROOT::EnableThreadSafety();
+
+    EventSource* src = EventSource::Open(inName);
+    if (!src) {
+        return 1;
+    }
+
+    MultiLoader* ml = new MultiLoader(MaxMult, MaxOrder);
+    vector<MultiLoader*> shards;
+    for (int t=0; t<nThreads; t++){
+        shards.push_back(nThreads == 1 ? ml : new MultiLoader(*ml, t, nThreads));
+    }
+
+    std::cout << "[LOG] Filling terms from " << inName << " with " << nThreads << " threads.\n";
+    auto start = std::chrono::steady_clock::now();
+    long long nEvents = 0;
+    PackedSource* packed = dynamic_cast<PackedSource*>(src);
+    if (packed) {
+        vector<std::thread> workers;
+        for (int t=0; t<nThreads; t++){
+            workers.push_back(std::thread([&, t](){
+                MultiLoader* shard = shards[t];
+                int mult, nTrack;
+                const float* pairs;
+                const char* ev = packed->Begin();
+                while (packed->Next(ev, mult, nTrack, pairs)){
+                    if (!shard->Accepts(mult)) {
+                        continue;
+                    }
+                    shard->ReadTrackPairs(pairs, nTrack);
+                    shard->Store(mult);
+                }
+            }));
+        }
+        for (int t=0; t<nThreads; t++){
+            workers[t].join();
+        }
+        nEvents = packed->GetNEvents();
+    }
+    EventBatch batch;
+    while (!packed && src->ReadBatch(batch, BatchSize) > 0){
+        const int n = batch.GetNEvents();
+        vector<std::thread> workers;
+        for (int t=0; t<nThreads; t++){
+            workers.push_back(std::thread([&, t](){
+                MultiLoader* shard = shards[t];
+                for (int e=0; e<n; e++){
+                    if (!shard->Accepts(batch.mult[e])) {
+                        continue;
+                    }
+                    long long first = batch.first[e];
+                    shard->ReadTracks(batch.charge.data() + first, batch.eff.data() + first, batch.first[e+1] - first);
+                    shard->Store(batch.mult[e]);
+                }
+            }));
+        }
+        for (int t=0; t<nThreads; t++){
+            workers[t].join();
+        }
+        nEvents += n;
+    }
+    delete src;
+    if (nThreads > 1) {
+        for (int t=0; t<nThreads; t++){
+            ml->Merge(*shards[t]);
+            delete shards[t];
+        }
+        ml->SetInputOffset(nEvents); // a shard only counts its own events
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[LOG] " << nEvents << " events in " << seconds << " s, " << (seconds > 0 ? nEvents / seconds : 0) << " events/s.\n";
+
+    std::cout << "[LOG] Saving to " << outName << ".\n";
+    string out(outName);
+    if (out.size() >= 5 && out.compare(out.size()-5, 5, ".root") == 0) {
+        ml->Save(outName);
+    } else {
+        ml->SaveBinary(outName);
+    }
+    delete ml;
+
+    std::cout << "[LOG] All done!.\n";
+
+    return 0;
+}
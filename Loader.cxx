@@ -2,2604 +2,818 @@
 #include "TProfile.h"
 #include "TH1D.h"
 #include "TFile.h"
+#include "TKey.h"
+#include "TList.h"
 #include "Loader.h"
+#include "QKernel.h"
+#include "TermFile.h"
 
-Loader::Loader(const char* type, int MaxMult) : ParticleType(type), _nMultBin(MaxMult+1){
-  for(int r=1;r<=6;++r){
-    for(int s=1; s<=r;++s){
-      _q[r][s] = 0;
-    }
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <set>
+#include <cmath>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+Loader::Loader(const char* type, int MaxMult, int MaxOrder) : _nMultBin(MaxMult+1), ParticleType(type), _spec(MaxOrder), _iShard(0), _nShards(1){
+  Init();
+}
+
+Loader::Loader(const Loader& proto, int iShard, int nShards) : _nMultBin(proto._nMultBin), ParticleType(proto.ParticleType), _spec(proto._spec), _iShard(iShard), _nShards(nShards){
+  Init();
+}
+
+void Loader::Init(){
+  _nTerms = _spec.GetNTerms();
+  _q.assign(_spec.GetNq(), 0);
+  _tb.assign((size_t)_nTerms*kPending, 0);
+  //(parent, factor) of every product term, packed for the Store loop
+  _plan.clear();
+  for(int i=_spec.GetNq(); i<_nTerms; ++i){
+    _plan.push_back(_spec.GetParent(i));
+    _plan.push_back(_spec.GetFactor(i));
   }
-  for(int i=1;i<=_nTerms;++i){
-    _V[i] = new TProfile(Form("%s_%s", ParticleType, Terms[i-1]),"", _nMultBin, -0.5, _nMultBin-0.5);
+  //a single track with weight +-1 gives term = Particle^R / eff^S, where
+  //R = sum of r and S = sum of s over the factors, only R's parity matters
+  _termS.assign(_nTerms, 0);
+  _termOdd.assign(_nTerms, 0);
+  for(int i=0; i<_nTerms; ++i){
+    const std::vector<int>& e = _spec.GetExponents(i);
+    int R = 0;
+    for(int k=0; k<_spec.GetNq(); ++k){
+      R += e[k] * _spec.GetQr(k);
+      _termS[i] += e[k] * _spec.GetQs(k);
+    }
+    _termOdd[i] = R % 2;
   }
+  _nSinglePow = 4*_spec.GetMaxOrder()+1; // S of term^2 goes up to 4*MaxOrder
+  _nTrack = 0;
+  _inputOffset = 0;
+  _ckEvents = 0;
+  _ckSeconds = 0;
+  _ckLastOffset = 0;
+  _ckSnapshot = 0;
+  _ckThread = 0;
+  _ckBusy = false;
+  _qDump = 0;
+  //rows are allocated when a bin gets its first event
+  _rows.assign(_nMultBin+2, std::vector<Double_t>());
+  _single.assign(_nMultBin+2, std::vector<Double_t>());
+  _entries.assign(_nMultBin+2, 0);
+  _pending.assign(_nMultBin+2, std::vector<Double_t>());
+  _nPending.assign(_nMultBin+2, 0);
 }
 
 
 Loader::~Loader(){
-  for(int i=1;i<=_nTerms;++i){
-    delete _V[i];
-  }
+  WaitCheckpoint();
+  delete _ckSnapshot;
+  SetQDump(0);
 }
 
 void Loader::ReadTrack(float Particle, float eff){
 
-  for(int r=1;r<=6; ++r){
-    for(int s=1; s<=r; ++s){
-      _q[r][s] += (pow(Particle,r)/pow(eff, s));
+  AccumulateQScalar(_spec.GetMaxOrder(), &Particle, &eff, 1, &_q[0]);
+  _nTrack += 1;
+
+}
+
+void Loader::ReadTracks(const float* Particle, const float* eff, int nTracks){
+
+  //vectorized over tracks when the CPU allows it, see QKernel
+  AccumulateQ(_spec.GetMaxOrder(), Particle, eff, nTracks, &_q[0]);
+  _nTrack += nTracks;
+
+}
+
+bool Loader::Accepts(int RefMult) const {
+  return FindBin(RefMult) % _nShards == _iShard;
+}
+
+void Loader::Merge(const Loader& other){
+  if(other._nTerms != _nTerms || other._nMultBin != _nMultBin){
+    std::cout << "[ERROR] Cannot merge Loader " << other.ParticleType << " into " << ParticleType << ", terms or binning differ.\n";
+    return;
+  }
+  //shards go through the same input, so the merged Loader goes on from the
+  //furthest of them
+  if(other._inputOffset > _inputOffset){
+    _inputOffset = other._inputOffset;
+  }
+  const int nq = _spec.GetNq();
+  std::vector<Double_t> q(nq);
+  for(size_t bin=0; bin<_rows.size(); ++bin){
+    AddRow(_rows[bin], other._rows[bin]);
+    AddRow(_single[bin], other._single[bin]);
+    _entries[bin] += other._entries[bin];
+    //the events still pending in other join ours in the same order, so a
+    //bin filled by one shard ends up exactly as if filled here
+    for(int e=0; e<other._nPending[bin]; ++e){
+      for(int k=0; k<nq; ++k){
+        q[k] = other._pending[bin][k*kPending+e];
+      }
+      Push(bin, &q[0]);
     }
   }
+}
+
+void Loader::AddRow(std::vector<Double_t>& dst, const std::vector<Double_t>& src){
+  if(src.empty()){ return; }
+  if(dst.empty()){
+    dst = src;
+    return;
+  }
+  for(size_t i=0; i<dst.size(); ++i){
+    dst[i] += src[i];
+  }
+}
+
+int Loader::FindBin(int RefMult) const {
+  //same bin convention as TProfile(_nMultBin, -0.5, _nMultBin-0.5)
+  if(RefMult < 0){ return 0; }
+  if(RefMult >= _nMultBin){ return _nMultBin+1; }
+  return RefMult+1;
+}
+
+void Loader::GetCell(int bin, int i, Double_t* cell) const {
+  //full events, plus the single-track events kept as powers of 1/eff
+  cell[0] = 0;
+  cell[1] = 0;
+  if(!_rows[bin].empty()){
+    cell[0] = _rows[bin][i*2];
+    cell[1] = _rows[bin][i*2+1];
+  }
+  if(!_single[bin].empty()){
+    cell[0] += _single[bin][2*_termS[i] + _termOdd[i]];
+    cell[1] += _single[bin][4*_termS[i]];
+  }
+}
 
+TProfile* Loader::MakeProfile(int i) const {
+  //rebuild the TProfile the per-event Fill(RefMult, term) calls used to give,
+  //on the fixed multiplicity axis, so files of different jobs can be hadd-ed
+  TProfile* p = new TProfile(Form("%s_%s", ParticleType, _spec.GetName(i)),"", _nMultBin, -0.5, _nMultBin-0.5);
+  p->SetDirectory(0);
+  Double_t* sum = p->GetArray();
+  Double_t* sum2 = p->GetSumw2()->GetArray();
+  TArrayD* binSumw2 = p->GetBinSumw2();
+  Double_t stats[6] = {0, 0, 0, 0, 0, 0};
+  Double_t nEntries = 0;
+  for(int bin=0; bin<=_nMultBin+1; ++bin){
+    Double_t n = _entries[bin];
+    if(n == 0){ continue; }
+    Double_t cell[2];
+    GetCell(bin, i, cell);
+    int j = bin; // same bin convention, see FindBin
+    sum[j] = cell[0];
+    sum2[j] = cell[1];
+    p->SetBinEntries(j, n);
+    if(binSumw2->fN){ binSumw2->fArray[j] = n; }
+    nEntries += n;
+    if(bin == 0 || bin == _nMultBin+1){ continue; } // under/overflow are not in the stats
+    Double_t x = bin-1;
+    stats[0] += n;
+    stats[1] += n;
+    stats[2] += n*x;
+    stats[3] += n*x*x;
+    stats[4] += cell[0];
+    stats[5] += cell[1];
+  }
+  p->PutStats(stats);
+  p->SetEntries(nEntries);
+  return p;
 }
 
 void Loader::Save(const char* OutName = "TempObj.root"){
 
+  Flush();
   TFile *out = new TFile(OutName, "recreate");
-  out->cd();
-  for(int i=1; i<=_nTerms; ++i){
-    _V[i]->Write();
-  }
+  Write(out, 0);
   out->Close();
+  delete out;
 }
 
 void Loader::Update(const char* OutName = "TempObj.root"){
 
+  //terms already in the file are added to ours and replaced, so every
+  //term keeps a single key cycle and jobs can be appended one by one
   TFile *out = new TFile(OutName, "update");
-  out->cd();
-  for(int i=1; i<=_nTerms; ++i){
-    _V[i]->Write();
+  if(out->IsZombie()){
+    std::cout << "[ERROR] Cannot update terms file " << OutName << ".\n";
+    delete out;
+    return;
+  }
+  //a file of another MaxOrder has other terms, updating only ours would
+  //leave the rest with the old events
+  std::set<std::string> names = ProfileNames(out);
+  int nFile = names.size();
+  if(nFile != 0 && nFile != _nTerms){
+    std::cout << "[ERROR] " << OutName << " has " << nFile << " " << ParticleType << " terms, MaxOrder " << _spec.GetMaxOrder() << " has " << _nTerms << ", not updated.\n";
+    out->Close();
+    delete out;
+    return;
+  }
+  Loader sum(*this, 0, 1);
+  sum.Merge(*this);
+  sum.Flush();
+  if(sum.ReadProfiles(out, names)){
+    //kOverwrite would only replace the highest cycle, files written by
+    //older versions can have more of them
+    for(int i=0; i<_nTerms; ++i){
+      out->Delete(Form("%s_%s;*", ParticleType, _spec.GetName(i)));
+    }
+    sum.Write(out, 0);
   }
   out->Close();
+  delete out;
+}
+
+void Loader::SaveBinary(const char* OutName){
+
+  FILE* out = fopen(OutName, "wb");
+  if(!out){
+    std::cout << "[ERROR] Cannot write terms file " << OutName << ".\n";
+    return;
+  }
+  Flush();
+  WriteBinary(out);
+  fclose(out);
+}
+
+void Loader::UpdateBinary(const char* OutName){
+
+  //same as Update: the section of this particle type is added to ours and
+  //replaced, the other sections are kept
+  std::vector<char> other;
+  bool found = false;
+  FILE* in = fopen(OutName, "rb");
+  if(in){
+    TermFileHeader head;
+    while(fread(&head, sizeof(head), 1, in) == 1){
+      if(memcmp(head.magic, TermFile::Magic(), 8) != 0 || head.size < (long long)sizeof(head)){
+        std::cout << "[ERROR] " << OutName << " is not a binary terms file, not updated.\n";
+        fclose(in);
+        return;
+      }
+      if(strncmp(head.type, ParticleType, sizeof(head.type)) == 0){
+        if(head.nTerms != _nTerms || head.maxOrder != _spec.GetMaxOrder()){
+          //rewriting it with our terms only would change its order
+          std::cout << "[ERROR] " << OutName << " has " << ParticleType << " terms of MaxOrder " << head.maxOrder << ", not " << _spec.GetMaxOrder() << ", not updated.\n";
+          fclose(in);
+          return;
+        }
+        found = true;
+        fseek(in, head.size - sizeof(head), SEEK_CUR);
+        continue;
+      }
+      size_t pos = other.size();
+      other.resize(pos + head.size);
+      memcpy(&other[pos], &head, sizeof(head));
+      if(fread(&other[pos+sizeof(head)], 1, head.size - sizeof(head), in) != head.size - sizeof(head)){
+        std::cout << "[ERROR] " << OutName << " is truncated, not updated.\n";
+        fclose(in);
+        return;
+      }
+    }
+    fclose(in);
+  }
+  Loader sum(*this, 0, 1);
+  sum.Merge(*this);
+  sum.Flush();
+  sum._inputOffset = _inputOffset; // written to the header, see Resume
+  if(found && !sum.ReadBinary(OutName)){
+    return;
+  }
+  FILE* out = fopen(OutName, "wb");
+  if(!out){
+    std::cout << "[ERROR] Cannot write terms file " << OutName << ".\n";
+    return;
+  }
+  if(!other.empty()){
+    fwrite(&other[0], 1, other.size(), out);
+  }
+  sum.WriteBinary(out);
+  fclose(out);
+}
+
+void Loader::WriteBinary(FILE* out) const {
+
+  //one section, see TermFile.h
+  std::vector<long long> bins;
+  std::vector<Double_t> entries;
+  for(int bin=0; bin<=_nMultBin+1; ++bin){
+    if(_entries[bin] == 0){ continue; }
+    bins.push_back(bin);
+    entries.push_back(_entries[bin]);
+  }
+  std::string names;
+  for(int i=0; i<_nTerms; ++i){
+    names += _spec.GetName(i);
+    names += '\0';
+  }
+  names.resize((names.size()+7) / 8 * 8, '\0');
+  TermFileHeader head;
+  memset(&head, 0, sizeof(head));
+  memcpy(head.magic, TermFile::Magic(), 8);
+  strncpy(head.type, ParticleType, sizeof(head.type)-1);
+  head.maxOrder = _spec.GetMaxOrder();
+  head.nTerms = _nTerms;
+  head.nBins = bins.size();
+  head.nMultBin = _nMultBin;
+  head.nameBytes = names.size();
+  head.offset = _inputOffset;
+  head.size = sizeof(head) + names.size() + bins.size()*(sizeof(long long) + sizeof(Double_t)*(1+2*_nTerms));
+  fwrite(&head, sizeof(head), 1, out);
+  fwrite(names.data(), 1, names.size(), out);
+  if(!bins.empty()){
+    fwrite(&bins[0], sizeof(long long), bins.size(), out);
+    fwrite(&entries[0], sizeof(Double_t), entries.size(), out);
+  }
+  std::vector<Double_t> row(2*_nTerms);
+  for(size_t b=0; b<bins.size(); ++b){
+    for(int i=0; i<_nTerms; ++i){
+      GetCell(bins[b], i, &row[2*i]);
+    }
+    fwrite(&row[0], sizeof(Double_t), row.size(), out);
+  }
+}
+
+bool Loader::ReadBinary(const char* FileName){
+
+  //adds the section of this particle type to the accumulators,
+  //Save afterwards gives the TProfile file of the same events
+  TermFile file(FileName);
+  return ReadBinary(file);
+}
+
+bool Loader::ReadBinary(const TermFile& file){
+
+  TermFile::Section sec;
+  if(!file.IsOpen() || !file.FindSection(ParticleType, sec)){
+    std::cout << "[ERROR] No " << ParticleType << " terms in " << file.GetName() << ".\n";
+    return false;
+  }
+  const int nFile = sec.head->nTerms;
+  std::vector<int> column(_nTerms, -1);
+  for(int j=0; j<nFile; ++j){
+    int i = _spec.FindTerm(sec.names[j]);
+    if(i >= 0){ column[i] = j; }
+  }
+  for(int i=0; i<_nTerms; ++i){
+    if(column[i] < 0){
+      std::cout << "[ERROR] Term " << ParticleType << "_" << _spec.GetName(i) << " is missing in " << file.GetName() << ".\n";
+      return false;
+    }
+  }
+  for(int b=0; b<sec.head->nBins; ++b){
+    long long fileBin = sec.bin[b];
+    int bin = fileBin == 0 ? 0 : fileBin > sec.head->nMultBin ? _nMultBin+1 : FindBin(fileBin-1);
+    if(bin % _nShards != _iShard){ continue; }
+    std::vector<Double_t>& r = _rows[bin];
+    if(r.empty()){
+      r.assign(2*_nTerms, 0);
+    }
+    const Double_t* cell = sec.sums + (long long)b*nFile*2;
+    for(int i=0; i<_nTerms; ++i){
+      r[2*i] += cell[2*column[i]];
+      r[2*i+1] += cell[2*column[i]+1];
+    }
+    _entries[bin] += sec.entries[b];
+  }
+  return true;
+}
+
+void Loader::SetCheckpoint(const char* FileName, long long nEvents, double seconds){
+
+  _ckName = FileName ? FileName : "";
+  _ckEvents = nEvents;
+  _ckSeconds = seconds;
+  _ckLastOffset = _inputOffset;
+  _ckLastTime = std::chrono::steady_clock::now();
+}
+
+bool Loader::Checkpoint(const char* FileName){
+
+  //the accumulators are copied into the snapshot buffer, which is written by
+  //a background thread, the event loop goes on in the meantime
+  if(_ckBusy){ return false; } // the previous one is still being written
+  WaitCheckpoint();
+  TakeSnapshot();
+  _ckBusy = true;
+  _ckThread = new std::thread(&Loader::WriteCheckpoint, this, std::string(FileName));
+  return true;
+}
+
+void Loader::Clear(){
+
+  //drops all events, e.g. those of a checkpoint that could not be resumed
+  for(size_t bin=0; bin<_rows.size(); ++bin){
+    _rows[bin].clear();
+    _single[bin].clear();
+    _entries[bin] = 0;
+    _nPending[bin] = 0;
+  }
+  _inputOffset = 0;
+  _ckLastOffset = 0;
+}
+
+void Loader::TakeSnapshot(){
+
+  if(!_ckSnapshot){
+    _ckSnapshot = new Loader(*this, _iShard, _nShards);
+  }
+  _ckSnapshot->_rows = _rows;
+  _ckSnapshot->_single = _single;
+  _ckSnapshot->_entries = _entries;
+  _ckSnapshot->_pending = _pending;
+  _ckSnapshot->_nPending = _nPending;
+  _ckSnapshot->_inputOffset = _inputOffset;
+}
+
+void Loader::WriteCheckpoint(std::string FileName){
+
+  //written under a temporary name and renamed, so a job killed meanwhile
+  //still finds the previous checkpoint
+  std::string tmp = FileName + ".tmp";
+  FILE* out = fopen(tmp.c_str(), "wb");
+  if(!out){
+    std::cout << "[ERROR] Cannot write checkpoint " << tmp << ".\n";
+    _ckBusy = false;
+    return;
+  }
+  _ckSnapshot->Flush(); // ours keep waiting, so checkpoints do not change the sums
+  _ckSnapshot->WriteBinary(out);
+  bool ok = fclose(out) == 0;
+  if(!ok || rename(tmp.c_str(), FileName.c_str()) != 0){
+    std::cout << "[ERROR] Cannot write checkpoint " << FileName << ".\n";
+  }
+  _ckBusy = false;
+}
+
+void Loader::WaitCheckpoint(){
+
+  if(_ckThread){
+    _ckThread->join();
+    delete _ckThread;
+    _ckThread = 0;
+  }
+}
+
+long long Loader::Resume(const char* FileName){
+
+  //for a new Loader: adds the checkpoint and returns the input offset to go on
+  //from, 0 if there is no checkpoint yet
+  FILE* in = fopen(FileName, "rb");
+  if(!in){
+    std::cout << "[LOG] No checkpoint " << FileName << ", starting from the beginning.\n";
+    return 0;
+  }
+  fclose(in);
+  long long offset = 0;
+  {
+    TermFile file(FileName);
+    TermFile::Section sec;
+    if(file.IsOpen() && file.FindSection(ParticleType, sec)){
+      offset = sec.head->offset;
+    }
+  }
+  if(!ReadBinary(FileName)){
+    return 0;
+  }
+  _inputOffset = offset;
+  _ckLastOffset = offset;
+  std::cout << "[LOG] Resumed " << ParticleType << " from " << FileName << " at input offset " << offset << ".\n";
+  return offset;
+}
+
+void Loader::SetQDump(const char* FileName){
+
+  //every Store writes RefMult, nTracks and the q's, see QDumpHeader, 0 stops
+  if(_qDump){
+    fclose(_qDump);
+    _qDump = 0;
+  }
+  if(!FileName){ return; }
+  _qDump = fopen(FileName, "wb");
+  if(!_qDump){
+    std::cout << "[ERROR] Cannot write q dump " << FileName << ".\n";
+    return;
+  }
+  setvbuf(_qDump, 0, _IOFBF, 1 << 20);
+  QDumpHeader head;
+  memset(&head, 0, sizeof(head));
+  memcpy(head.magic, QDumpHeader::Magic(), 8);
+  strncpy(head.type, ParticleType, sizeof(head.type)-1);
+  head.maxOrder = _spec.GetMaxOrder();
+  head.nq = _spec.GetNq();
+  fwrite(&head, sizeof(head), 1, _qDump);
+}
+
+long long Loader::Replay(const char* FileName, int nThreads){
+
+  //Stores every event of a q dump, the q's of a higher order dump start
+  //with the ones of this order (TermSpec::QIndex), so they can be replayed
+  //here as well. Each thread fills a shard, see Merge.
+  int fd = open(FileName, O_RDONLY);
+  struct stat st;
+  if(fd < 0 || fstat(fd, &st) != 0 || st.st_size < (long long)sizeof(QDumpHeader)){
+    std::cout << "[ERROR] Cannot read q dump " << FileName << ".\n";
+    if(fd >= 0){ close(fd); }
+    return 0;
+  }
+  void* map = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(map == MAP_FAILED){
+    std::cout << "[ERROR] Cannot map q dump " << FileName << ".\n";
+    return 0;
+  }
+  const char* data = (const char*)map;
+  const QDumpHeader* head = (const QDumpHeader*)data;
+  if(memcmp(head->magic, QDumpHeader::Magic(), 8) != 0 || head->maxOrder < _spec.GetMaxOrder()){
+    std::cout << "[ERROR] " << FileName << " is not a q dump of order " << _spec.GetMaxOrder() << " or more.\n";
+    munmap(map, st.st_size);
+    return 0;
+  }
+  const long long recSize = 2*sizeof(int) + head->nq*sizeof(Double_t);
+  const long long nEvents = (st.st_size - sizeof(QDumpHeader)) / recSize;
+  const char* first = data + sizeof(QDumpHeader);
+
+  if(nThreads < 1){ nThreads = 1; }
+  std::vector<Loader*> shards;
+  for(int t=0; t<nThreads; ++t){
+    shards.push_back(nThreads == 1 ? this : new Loader(*this, t, nThreads));
+  }
+  std::vector<std::thread> workers;
+  for(int t=0; t<nThreads; ++t){
+    workers.push_back(std::thread([&, t](){
+      Loader* shard = shards[t];
+      for(long long e=0; e<nEvents; ++e){
+        const char* rec = first + e*recSize;
+        const int* ev = (const int*)rec;
+        if(!shard->Accepts(ev[0])){ continue; }
+        shard->Store(ev[0], (const Double_t*)(rec + 2*sizeof(int)), ev[1]);
+      }
+    }));
+  }
+  for(int t=0; t<nThreads; ++t){
+    workers[t].join();
+  }
+  if(nThreads > 1){
+    long long offset = _inputOffset;
+    for(int t=0; t<nThreads; ++t){
+      Merge(*shards[t]);
+      delete shards[t];
+    }
+    _inputOffset = offset + nEvents; // as if Stored here one by one
+  }
+  munmap(map, st.st_size);
+  return nEvents;
+}
+
+bool Loader::Add(const char* FileName){
+
+  //adds the terms of this particle type in a TProfile or binary terms file
+  if(TermFile::IsTermFile(FileName)){
+    return ReadBinary(FileName);
+  }
+  TFile* in = new TFile(FileName);
+  if(in->IsZombie()){
+    std::cout << "[ERROR] Cannot open terms file " << FileName << ".\n";
+    delete in;
+    return false;
+  }
+  bool ok = Add(in);
+  in->Close();
+  delete in;
+  return ok;
+}
+
+bool Loader::Add(TDirectory* dir){
+
+  //unlike Update, a file without our terms is an error here
+  std::set<std::string> names = ProfileNames(dir);
+  if(names.empty()){
+    std::cout << "[ERROR] No " << ParticleType << " terms in " << dir->GetName() << ".\n";
+    return false;
+  }
+  return ReadProfiles(dir, names);
+}
+
+std::set<std::string> Loader::ProfileNames(TDirectory* dir) const {
+
+  //distinct "<type>_<term>" TProfiles in dir, of any order
+  std::set<std::string> names;
+  std::string prefix = std::string(ParticleType) + "_";
+  TIter next(dir->GetListOfKeys());
+  TKey* key;
+  while((key = (TKey*)next())){
+    if(strcmp(key->GetClassName(), "TProfile") != 0){ continue; }
+    if(strncmp(key->GetName(), prefix.c_str(), prefix.size()) == 0){
+      names.insert(key->GetName());
+    }
+  }
+  return names;
+}
+
+bool Loader::ReadProfiles(TDirectory* dir, const std::set<std::string>& names){
+
+  //adds the TProfiles of this particle type in dir, if there are any, one
+  //at a time, so only one of them is in memory
+  int nFound = 0;
+  for(int i=0; i<_nTerms; ++i){
+    if(names.count(std::string(ParticleType) + "_" + _spec.GetName(i))){ nFound++; }
+  }
+  if(nFound != _nTerms){
+    if(nFound > 0){
+      std::cout << "[ERROR] Only " << nFound << " of " << _nTerms << " " << ParticleType << " terms in " << dir->GetName() << ", not updated.\n";
+    }
+    return nFound == 0;
+  }
+  for(int i=0; i<_nTerms; ++i){
+    TProfile* p = 0;
+    dir->GetObject(Form("%s_%s", ParticleType, _spec.GetName(i)), p);
+    if(!p){
+      std::cout << "[ERROR] Cannot read " << ParticleType << "_" << _spec.GetName(i) << " in " << dir->GetName() << ", its terms are incomplete.\n";
+      return false;
+    }
+    const Double_t* sum = p->GetArray();
+    const Double_t* sum2 = p->GetSumw2()->GetArray();
+    const int nBins = p->GetNbinsX();
+    for(int j=0; j<=nBins+1; ++j){
+      Double_t n = p->GetBinEntries(j);
+      if(n == 0){ continue; }
+      int bin = j == 0 ? 0 : j > nBins ? _nMultBin+1 : FindBin((int)floor(p->GetXaxis()->GetBinCenter(j)+0.5));
+      if(bin % _nShards != _iShard){ continue; }
+      std::vector<Double_t>& r = _rows[bin];
+      if(r.empty()){
+        r.assign(2*_nTerms, 0);
+      }
+      r[2*i] += sum[j];
+      r[2*i+1] += sum2[j];
+      if(i == 0){ _entries[bin] += n; }
+    }
+    delete p;
+  }
+  return true;
+}
+
+void Loader::Write(TDirectory* out, int option) const {
+
+  out->cd();
+  for(int i=0; i<_nTerms; ++i){
+    TProfile* p = MakeProfile(i);
+    p->Write(0, option);
+    delete p;
+  }
 }
 
 
 
 void Loader::Store(int RefMult){
 
-  //xxxxxxxxxxxxxxxxxxxxxxxxxxx
-  _V[1]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[3][2]*_q[3][3]);
-  _V[2]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[3][1]*_q[3][3]);
-  _V[3]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[3][1]*_q[3][2]);
-  _V[4]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[3][2]*_q[3][3]);
-  _V[5]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[3][2]*_q[3][3]);
-  _V[6]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][3]*_q[4][4]);
-  _V[7]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][3]*_q[4][3]);
-  _V[8]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][3]*_q[4][2]);
-  _V[9]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][3]*_q[4][1]);
-  _V[10]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][2]*_q[4][4]);
-  _V[11]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][2]*_q[4][3]);
-  _V[12]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][2]*_q[4][2]);
-  _V[13]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][2]*_q[4][1]);
-  _V[14]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][2]*_q[3][3]);
-  _V[15]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][1]*_q[4][4]);
-  _V[16]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][1]*_q[4][3]);
-  _V[17]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][1]*_q[4][2]);
-  _V[18]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][1]*_q[4][1]);
-  _V[19]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][1]*_q[3][3]);
-  _V[20]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][1]*_q[3][2]);
-  _V[21]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*pow(_q[2][2],2)*_q[3][3]);
-  _V[22]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*pow(_q[2][2],2)*_q[3][2]);
-  _V[23]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*pow(_q[2][2],2)*_q[3][1]);
-  _V[24]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*pow(_q[2][2],2)*_q[3][3]);
-  _V[25]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*pow(_q[2][2],2)*_q[3][2]);
-  _V[26]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*pow(_q[2][2],2)*_q[3][1]);
-  _V[27]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[2][2]*_q[3][3]);
-  _V[28]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[2][2]*_q[3][2]);
-  _V[29]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[2][2]*_q[3][1]);
-  _V[30]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[3][2]*_q[3][3]);
-  _V[31]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[3][1]*_q[3][3]);
-  _V[32]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[3][1]*_q[3][2]);
-  _V[33]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*pow(_q[3][3],2));
-  _V[34]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*pow(_q[3][2],2));
-  _V[35]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*pow(_q[3][1],2));
-  _V[36]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],2)*_q[4][4]);
-  _V[37]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],2)*_q[4][3]);
-  _V[38]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],2)*_q[4][2]);
-  _V[39]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],2)*_q[4][1]);
-  _V[40]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],2)*_q[3][3]);
-  _V[41]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],2)*_q[3][2]);
-  _V[42]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],2)*_q[3][1]);
-  _V[43]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[3][2]*_q[3][3]);
-  _V[44]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[3][1]*_q[3][3]);
-  _V[45]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[3][1]*_q[3][2]);
-  _V[46]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[2][2]*_q[4][4]);
-  _V[47]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[2][2]*_q[4][3]);
-  _V[48]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[2][2]*_q[4][2]);
-  _V[49]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[2][2]*_q[4][1]);
-  _V[50]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[2][2]*_q[3][3]);
-  _V[51]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[2][2]*_q[3][2]);
-  _V[52]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[2][2]*_q[3][1]);
-  _V[53]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[3][2]*_q[3][3]);
-  _V[54]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[3][1]*_q[3][3]);
-  _V[55]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[3][1]*_q[3][2]);
-  _V[56]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[3][2]*_q[3][3]);
-  _V[57]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[3][1]*_q[3][3]);
-  _V[58]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[3][1]*_q[3][2]);
-  _V[59]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*pow(_q[3][3],2));
-  _V[60]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][2],2)*_q[3][3]);
-  _V[61]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*pow(_q[3][3],2));
-  _V[62]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*pow(_q[3][2],2));
-  _V[63]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][1],2)*_q[3][3]);
-  _V[64]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][1],2)*_q[3][2]);
-  _V[65]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][3]*_q[4][4]);
-  _V[66]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][3]*_q[4][3]);
-  _V[67]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][3]*_q[4][2]);
-  _V[68]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][3]*_q[4][1]);
-  _V[69]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][2]*_q[4][4]);
-  _V[70]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][2]*_q[4][3]);
-  _V[71]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][2]*_q[4][2]);
-  _V[72]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][2]*_q[4][1]);
-  _V[73]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][2]*_q[3][3]);
-  _V[74]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][1]*_q[4][4]);
-  _V[75]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][1]*_q[4][3]);
-  _V[76]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][1]*_q[4][2]);
-  _V[77]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][1]*_q[4][1]);
-  _V[78]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][1]*_q[3][3]);
-  _V[79]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][1]*_q[3][2]);
-  _V[80]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*pow(_q[3][3],2));
-  _V[81]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][2],2)*_q[3][3]);
-  _V[82]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*pow(_q[3][3],2));
-  _V[83]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*pow(_q[3][2],2));
-  _V[84]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][1],2)*_q[3][3]);
-  _V[85]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][1],2)*_q[3][2]);
-  _V[86]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*pow(_q[3][3],2));
-  _V[87]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*pow(_q[3][2],2));
-  _V[88]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*pow(_q[3][1],2));
-  _V[89]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],3)*_q[3][3]);
-  _V[90]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],3)*_q[3][2]);
-  _V[91]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],3)*_q[3][1]);
-  _V[92]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[5][5]);
-  _V[93]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[5][4]);
-  _V[94]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[5][3]);
-  _V[95]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[5][2]);
-  _V[96]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[5][1]);
-  _V[97]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[4][4]);
-  _V[98]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[4][3]);
-  _V[99]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[4][2]);
-  _V[100]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[4][1]);
-  _V[101]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[3][3]);
-  _V[102]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[3][2]);
-  _V[103]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2)*_q[3][1]);
-  _V[104]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[2][2]*_q[3][3]);
-  _V[105]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[2][2]*_q[3][2]);
-  _V[106]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[2][2]*_q[3][1]);
-  _V[107]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][3]*_q[4][4]);
-  _V[108]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][3]*_q[4][3]);
-  _V[109]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][3]*_q[4][2]);
-  _V[110]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][3]*_q[4][1]);
-  _V[111]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][2]*_q[4][4]);
-  _V[112]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][2]*_q[4][3]);
-  _V[113]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][2]*_q[4][2]);
-  _V[114]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][2]*_q[4][1]);
-  _V[115]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][2]*_q[3][3]);
-  _V[116]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][1]*_q[4][4]);
-  _V[117]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][1]*_q[4][3]);
-  _V[118]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][1]*_q[4][2]);
-  _V[119]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][1]*_q[4][1]);
-  _V[120]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][1]*_q[3][3]);
-  _V[121]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][1]*_q[3][2]);
-  _V[122]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[5][5]);
-  _V[123]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[5][4]);
-  _V[124]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[5][3]);
-  _V[125]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[5][2]);
-  _V[126]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[5][1]);
-  _V[127]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[4][4]);
-  _V[128]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[4][3]);
-  _V[129]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[4][2]);
-  _V[130]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[4][1]);
-  _V[131]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[3][3]);
-  _V[132]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[3][2]);
-  _V[133]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]*_q[3][1]);
-  _V[134]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[2][2]*_q[3][3]);
-  _V[135]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[2][2]*_q[3][2]);
-  _V[136]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[2][2]*_q[3][1]);
-  _V[137]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[3][2]*_q[3][3]);
-  _V[138]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[3][1]*_q[3][3]);
-  _V[139]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[3][1]*_q[3][2]);
-  _V[140]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[3][2]*_q[3][3]);
-  _V[141]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[3][1]*_q[3][3]);
-  _V[142]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[3][1]*_q[3][2]);
-  _V[143]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[2][2]*_q[4][4]);
-  _V[144]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[2][2]*_q[4][3]);
-  _V[145]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[2][2]*_q[4][2]);
-  _V[146]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[2][2]*_q[4][1]);
-  _V[147]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[2][2]*_q[3][3]);
-  _V[148]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[2][2]*_q[3][2]);
-  _V[149]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[2][2]*_q[3][1]);
-  _V[150]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[3][2]*_q[3][3]);
-  _V[151]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][3]*_q[4][4]);
-  _V[152]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][3]*_q[4][3]);
-  _V[153]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][3]*_q[4][2]);
-  _V[154]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][3]*_q[4][1]);
-  _V[155]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][2]*_q[4][4]);
-  _V[156]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][2]*_q[4][3]);
-  _V[157]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][2]*_q[4][2]);
-  _V[158]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][2]*_q[4][1]);
-  _V[159]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][2]*_q[3][3]);
-  _V[160]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][1]*_q[4][4]);
-  _V[161]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][1]*_q[4][3]);
-  _V[162]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][1]*_q[4][2]);
-  _V[163]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][1]*_q[4][1]);
-  _V[164]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][1]*_q[3][3]);
-  _V[165]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][1]*_q[3][2]);
-  _V[166]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][3]*_q[4][4]);
-  _V[167]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][3]*_q[4][3]);
-  _V[168]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][3]*_q[4][2]);
-  _V[169]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][3]*_q[4][1]);
-  _V[170]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][2]*_q[4][4]);
-  _V[171]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][2]*_q[4][3]);
-  _V[172]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][2]*_q[4][2]);
-  _V[173]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][2]*_q[4][1]);
-  _V[174]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][2]*_q[3][3]);
-  _V[175]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][1]*_q[4][4]);
-  _V[176]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][1]*_q[4][3]);
-  _V[177]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][1]*_q[4][2]);
-  _V[178]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][1]*_q[4][1]);
-  _V[179]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][1]*_q[3][3]);
-  _V[180]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][1]*_q[3][2]);
-  _V[181]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[5][5]);
-  _V[182]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[5][4]);
-  _V[183]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[5][3]);
-  _V[184]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[5][2]);
-  _V[185]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[5][1]);
-  _V[186]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[4][4]);
-  _V[187]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[4][3]);
-  _V[188]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[4][2]);
-  _V[189]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[4][1]);
-  _V[190]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[3][3]);
-  _V[191]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[3][2]);
-  _V[192]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]*_q[3][1]);
-  _V[193]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[3][3]*_q[4][4]);
-  _V[194]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[3][3]*_q[4][3]);
-  _V[195]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[3][3]*_q[4][2]);
-  _V[196]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[3][3]*_q[4][1]);
-  _V[197]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][3]*_q[4][4]);
-  _V[198]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][3]*_q[4][3]);
-  _V[199]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][3]*_q[4][2]);
-  _V[200]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][3]*_q[4][1]);
-  _V[201]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][2]*_q[4][4]);
-  _V[202]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][2]*_q[4][3]);
-  _V[203]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][2]*_q[4][2]);
-  _V[204]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][2]*_q[4][1]);
-  _V[205]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][2]*_q[3][3]);
-  _V[206]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][3]*_q[4][4]);
-  _V[207]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][2]*_q[4][4]);
-  _V[208]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][2]*_q[4][3]);
-  _V[209]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][1]*_q[4][4]);
-  _V[210]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][1]*_q[4][3]);
-  _V[211]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][1]*_q[4][2]);
-  _V[212]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[5][5]);
-  _V[213]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[5][4]);
-  _V[214]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[5][3]);
-  _V[215]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[5][2]);
-  _V[216]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[5][1]);
-  _V[217]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[4][4]);
-  _V[218]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[4][3]);
-  _V[219]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[4][2]);
-  _V[220]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]*_q[4][1]);
-  _V[221]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[5][5]);
-  _V[222]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[5][4]);
-  _V[223]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[5][3]);
-  _V[224]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[5][2]);
-  _V[225]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[5][1]);
-  _V[226]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[4][4]);
-  _V[227]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[4][3]);
-  _V[228]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[4][2]);
-  _V[229]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[4][1]);
-  _V[230]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]*_q[3][3]);
-  _V[231]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[5][5]);
-  _V[232]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[5][4]);
-  _V[233]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[5][3]);
-  _V[234]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[5][2]);
-  _V[235]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[5][1]);
-  _V[236]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[4][4]);
-  _V[237]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[4][3]);
-  _V[238]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[4][2]);
-  _V[239]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[4][1]);
-  _V[240]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[3][3]);
-  _V[241]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]*_q[3][2]);
-  _V[242]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][3]*_q[4][4]);
-  _V[243]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][2]*_q[4][4]);
-  _V[244]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][2]*_q[4][3]);
-  _V[245]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][1]*_q[4][4]);
-  _V[246]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][1]*_q[4][3]);
-  _V[247]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][1]*_q[4][2]);
-  _V[248]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[5][5]);
-  _V[249]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[5][4]);
-  _V[250]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[5][3]);
-  _V[251]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[5][2]);
-  _V[252]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[5][1]);
-  _V[253]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[4][4]);
-  _V[254]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[4][3]);
-  _V[255]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[4][2]);
-  _V[256]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]*_q[4][1]);
-  _V[257]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[5][5]);
-  _V[258]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[5][4]);
-  _V[259]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[5][3]);
-  _V[260]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[5][2]);
-  _V[261]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[5][1]);
-  _V[262]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[4][4]);
-  _V[263]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[4][3]);
-  _V[264]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[4][2]);
-  _V[265]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[4][1]);
-  _V[266]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]*_q[3][3]);
-  _V[267]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[5][5]);
-  _V[268]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[5][4]);
-  _V[269]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[5][3]);
-  _V[270]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[5][2]);
-  _V[271]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[5][1]);
-  _V[272]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[4][4]);
-  _V[273]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[4][3]);
-  _V[274]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[4][2]);
-  _V[275]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[4][1]);
-  _V[276]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[3][3]);
-  _V[277]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]*_q[3][2]);
-  _V[278]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[6][6]);
-  _V[279]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[6][5]);
-  _V[280]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[6][4]);
-  _V[281]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[6][3]);
-  _V[282]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[6][2]);
-  _V[283]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[6][1]);
-  _V[284]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[5][5]);
-  _V[285]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[5][4]);
-  _V[286]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[5][3]);
-  _V[287]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[5][2]);
-  _V[288]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[5][1]);
-  _V[289]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[4][4]);
-  _V[290]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[4][3]);
-  _V[291]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[4][2]);
-  _V[292]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[4][1]);
-  _V[293]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[3][3]);
-  _V[294]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[3][2]);
-  _V[295]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]*_q[3][1]);
-  _V[296]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[3][3]*_q[4][4]);
-  _V[297]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[3][3]*_q[4][3]);
-  _V[298]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[3][3]*_q[4][2]);
-  _V[299]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[3][3]*_q[4][1]);
-  _V[300]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][3]*_q[4][4]);
-  _V[301]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][3]*_q[4][3]);
-  _V[302]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][3]*_q[4][2]);
-  _V[303]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][3]*_q[4][1]);
-  _V[304]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][2]*_q[4][4]);
-  _V[305]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][2]*_q[4][3]);
-  _V[306]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][2]*_q[4][2]);
-  _V[307]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][2]*_q[4][1]);
-  _V[308]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][2]*_q[3][3]);
-  _V[309]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[3][3]*_q[4][4]);
-  _V[310]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[3][3]*_q[4][3]);
-  _V[311]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[3][3]*_q[4][2]);
-  _V[312]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[3][3]*_q[4][1]);
-  _V[313]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][3]*_q[4][4]);
-  _V[314]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][3]*_q[4][3]);
-  _V[315]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][3]*_q[4][2]);
-  _V[316]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][3]*_q[4][1]);
-  _V[317]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][2]*_q[4][4]);
-  _V[318]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][2]*_q[4][3]);
-  _V[319]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][2]*_q[4][2]);
-  _V[320]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][2]*_q[4][1]);
-  _V[321]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][2]*_q[3][3]);
-  _V[322]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][3]*_q[4][4]);
-  _V[323]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][2]*_q[4][4]);
-  _V[324]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][2]*_q[4][3]);
-  _V[325]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][1]*_q[4][4]);
-  _V[326]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][1]*_q[4][3]);
-  _V[327]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][1]*_q[4][2]);
-  _V[328]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][3]*_q[4][4]);
-  _V[329]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][3]*_q[4][3]);
-  _V[330]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][3]*_q[4][2]);
-  _V[331]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][3]*_q[4][1]);
-  _V[332]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][2]*_q[4][4]);
-  _V[333]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][2]*_q[4][3]);
-  _V[334]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][2]*_q[4][2]);
-  _V[335]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][2]*_q[4][1]);
-  _V[336]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][2]*_q[3][3]);
-  _V[337]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][1]*_q[4][4]);
-  _V[338]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][1]*_q[4][3]);
-  _V[339]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][1]*_q[4][2]);
-  _V[340]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][1]*_q[4][1]);
-  _V[341]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][1]*_q[3][3]);
-  _V[342]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][1]*_q[3][2]);
-  _V[343]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[5][5]);
-  _V[344]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[5][4]);
-  _V[345]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[5][3]);
-  _V[346]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[5][2]);
-  _V[347]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[5][1]);
-  _V[348]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[4][4]);
-  _V[349]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[4][3]);
-  _V[350]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[4][2]);
-  _V[351]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]*_q[4][1]);
-  _V[352]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[5][5]);
-  _V[353]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[5][4]);
-  _V[354]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[5][3]);
-  _V[355]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[5][2]);
-  _V[356]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[5][1]);
-  _V[357]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[4][4]);
-  _V[358]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[4][3]);
-  _V[359]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[4][2]);
-  _V[360]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]*_q[4][1]);
-  _V[361]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[5][5]);
-  _V[362]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[5][4]);
-  _V[363]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[5][3]);
-  _V[364]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[5][2]);
-  _V[365]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[5][1]);
-  _V[366]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[4][4]);
-  _V[367]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[4][3]);
-  _V[368]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[4][2]);
-  _V[369]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[4][1]);
-  _V[370]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]*_q[3][3]);
-  _V[371]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][4]*_q[5][5]);
-  _V[372]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][4]*_q[5][4]);
-  _V[373]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][4]*_q[5][3]);
-  _V[374]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][4]*_q[5][2]);
-  _V[375]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][4]*_q[5][1]);
-  _V[376]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][3]*_q[5][5]);
-  _V[377]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][3]*_q[5][4]);
-  _V[378]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][3]*_q[5][3]);
-  _V[379]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][3]*_q[5][2]);
-  _V[380]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][3]*_q[5][1]);
-  _V[381]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][3]*_q[4][4]);
-  _V[382]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][2]*_q[5][5]);
-  _V[383]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][2]*_q[5][4]);
-  _V[384]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][2]*_q[5][3]);
-  _V[385]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][2]*_q[5][2]);
-  _V[386]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][2]*_q[5][1]);
-  _V[387]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][2]*_q[4][4]);
-  _V[388]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][2]*_q[4][3]);
-  _V[389]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]*_q[5][5]);
-  _V[390]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]*_q[5][4]);
-  _V[391]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]*_q[5][3]);
-  _V[392]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]*_q[5][2]);
-  _V[393]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]*_q[5][1]);
-  _V[394]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]*_q[4][4]);
-  _V[395]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]*_q[4][3]);
-  _V[396]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]*_q[4][2]);
-  _V[397]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[6][6]);
-  _V[398]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[6][5]);
-  _V[399]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[6][4]);
-  _V[400]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[6][3]);
-  _V[401]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[6][2]);
-  _V[402]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[6][1]);
-  _V[403]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[5][5]);
-  _V[404]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[5][4]);
-  _V[405]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[5][3]);
-  _V[406]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[5][2]);
-  _V[407]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[5][1]);
-  _V[408]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[4][4]);
-  _V[409]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[4][3]);
-  _V[410]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[4][2]);
-  _V[411]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]*_q[4][1]);
-  _V[412]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[6][6]);
-  _V[413]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[6][5]);
-  _V[414]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[6][4]);
-  _V[415]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[6][3]);
-  _V[416]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[6][2]);
-  _V[417]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[6][1]);
-  _V[418]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[5][5]);
-  _V[419]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[5][4]);
-  _V[420]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[5][3]);
-  _V[421]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[5][2]);
-  _V[422]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[5][1]);
-  _V[423]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[4][4]);
-  _V[424]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[4][3]);
-  _V[425]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[4][2]);
-  _V[426]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[4][1]);
-  _V[427]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]*_q[3][3]);
-  _V[428]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[6][6]);
-  _V[429]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[6][5]);
-  _V[430]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[6][4]);
-  _V[431]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[6][3]);
-  _V[432]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[6][2]);
-  _V[433]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[6][1]);
-  _V[434]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[5][5]);
-  _V[435]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[5][4]);
-  _V[436]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[5][3]);
-  _V[437]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[5][2]);
-  _V[438]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[5][1]);
-  _V[439]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[4][4]);
-  _V[440]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[4][3]);
-  _V[441]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[4][2]);
-  _V[442]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[4][1]);
-  _V[443]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[3][3]);
-  _V[444]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]*_q[3][2]);
-  _V[445]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][4]*_q[5][5]);
-  _V[446]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][4]*_q[5][4]);
-  _V[447]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][4]*_q[5][3]);
-  _V[448]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][4]*_q[5][2]);
-  _V[449]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][4]*_q[5][1]);
-  _V[450]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][3]*_q[5][5]);
-  _V[451]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][3]*_q[5][4]);
-  _V[452]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][3]*_q[5][3]);
-  _V[453]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][3]*_q[5][2]);
-  _V[454]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][3]*_q[5][1]);
-  _V[455]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][3]*_q[4][4]);
-  _V[456]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][2]*_q[5][5]);
-  _V[457]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][2]*_q[5][4]);
-  _V[458]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][2]*_q[5][3]);
-  _V[459]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][2]*_q[5][2]);
-  _V[460]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][2]*_q[5][1]);
-  _V[461]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][2]*_q[4][4]);
-  _V[462]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][2]*_q[4][3]);
-  _V[463]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]*_q[5][5]);
-  _V[464]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]*_q[5][4]);
-  _V[465]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]*_q[5][3]);
-  _V[466]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]*_q[5][2]);
-  _V[467]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]*_q[5][1]);
-  _V[468]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]*_q[4][4]);
-  _V[469]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]*_q[4][3]);
-  _V[470]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]*_q[4][2]);
-  _V[471]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[6][6]);
-  _V[472]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[6][5]);
-  _V[473]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[6][4]);
-  _V[474]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[6][3]);
-  _V[475]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[6][2]);
-  _V[476]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[6][1]);
-  _V[477]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[5][5]);
-  _V[478]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[5][4]);
-  _V[479]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[5][3]);
-  _V[480]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[5][2]);
-  _V[481]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[5][1]);
-  _V[482]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[4][4]);
-  _V[483]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[4][3]);
-  _V[484]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[4][2]);
-  _V[485]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]*_q[4][1]);
-  _V[486]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[6][6]);
-  _V[487]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[6][5]);
-  _V[488]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[6][4]);
-  _V[489]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[6][3]);
-  _V[490]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[6][2]);
-  _V[491]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[6][1]);
-  _V[492]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[5][5]);
-  _V[493]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[5][4]);
-  _V[494]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[5][3]);
-  _V[495]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[5][2]);
-  _V[496]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[5][1]);
-  _V[497]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[4][4]);
-  _V[498]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[4][3]);
-  _V[499]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[4][2]);
-  _V[500]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[4][1]);
-  _V[501]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]*_q[3][3]);
-  _V[502]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[6][6]);
-  _V[503]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[6][5]);
-  _V[504]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[6][4]);
-  _V[505]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[6][3]);
-  _V[506]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[6][2]);
-  _V[507]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[6][1]);
-  _V[508]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[5][5]);
-  _V[509]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[5][4]);
-  _V[510]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[5][3]);
-  _V[511]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[5][2]);
-  _V[512]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[5][1]);
-  _V[513]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[4][4]);
-  _V[514]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[4][3]);
-  _V[515]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[4][2]);
-  _V[516]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[4][1]);
-  _V[517]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[3][3]);
-  _V[518]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]*_q[3][2]);
-  _V[519]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[6][6]);
-  _V[520]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[6][5]);
-  _V[521]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[6][4]);
-  _V[522]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[6][3]);
-  _V[523]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[6][2]);
-  _V[524]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[6][1]);
-  _V[525]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[5][5]);
-  _V[526]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[5][4]);
-  _V[527]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[5][3]);
-  _V[528]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[5][2]);
-  _V[529]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[5][1]);
-  _V[530]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[4][4]);
-  _V[531]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[4][3]);
-  _V[532]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[4][2]);
-  _V[533]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[4][1]);
-  _V[534]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][3]);
-  _V[535]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][2]);
-  _V[536]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]*_q[3][1]);
-  _V[537]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*pow(_q[2][2],2));
-  _V[538]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*pow(_q[2][2],2));
-  _V[539]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*pow(_q[3][3],2));
-  _V[540]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*pow(_q[3][2],2));
-  _V[541]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*pow(_q[3][1],2));
-  _V[542]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*pow(_q[2][2],2));
-  _V[543]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*pow(_q[3][3],2));
-  _V[544]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*pow(_q[3][2],2));
-  _V[545]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*pow(_q[3][1],2));
-  _V[546]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*pow(_q[2][2],3));
-  _V[547]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*pow(_q[2][2],2));
-  _V[548]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*pow(_q[3][3],2));
-  _V[549]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*pow(_q[3][2],2));
-  _V[550]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*pow(_q[3][1],2));
-  _V[551]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*pow(_q[3][3],2));
-  _V[552]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*pow(_q[3][2],2));
-  _V[553]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*pow(_q[3][1],2));
-  _V[554]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],2)*_q[4][4]);
-  _V[555]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],2)*_q[4][3]);
-  _V[556]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],2)*_q[4][2]);
-  _V[557]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],2)*_q[4][1]);
-  _V[558]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],2)*_q[3][3]);
-  _V[559]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],2)*_q[3][2]);
-  _V[560]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],2)*_q[3][1]);
-  _V[561]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*pow(_q[3][3],2));
-  _V[562]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*pow(_q[3][2],2));
-  _V[563]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*pow(_q[3][1],2));
-  _V[564]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*pow(_q[2][2],2));
-  _V[565]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*pow(_q[3][3],2));
-  _V[566]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*pow(_q[3][2],2));
-  _V[567]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*pow(_q[3][1],2));
-  _V[568]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*pow(_q[2][2],3));
-  _V[569]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*pow(_q[2][2],2));
-  _V[570]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*pow(_q[2][2],2));
-  _V[571]->Fill(RefMult, pow(_q[1][1],6)*pow(_q[2][1],2)*_q[2][2]);
-  _V[572]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][2],2)*_q[3][3]);
-  _V[573]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][2],2)*_q[3][2]);
-  _V[574]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][2],2)*_q[3][1]);
-  _V[575]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*pow(_q[2][2],2));
-  _V[576]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][1],2)*_q[3][3]);
-  _V[577]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][1],2)*_q[3][2]);
-  _V[578]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][1],2)*_q[3][1]);
-  _V[579]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][1],2)*_q[2][2]);
-  _V[580]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*pow(_q[3][3],2));
-  _V[581]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*pow(_q[3][2],2));
-  _V[582]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*pow(_q[3][1],2));
-  _V[583]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],2)*_q[4][4]);
-  _V[584]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],2)*_q[4][3]);
-  _V[585]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],2)*_q[4][2]);
-  _V[586]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],2)*_q[4][1]);
-  _V[587]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],2)*_q[3][3]);
-  _V[588]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],2)*_q[3][2]);
-  _V[589]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],2)*_q[3][1]);
-  _V[590]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*pow(_q[3][3],2));
-  _V[591]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*pow(_q[3][2],2));
-  _V[592]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*pow(_q[3][1],2));
-  _V[593]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*pow(_q[2][2],3));
-  _V[594]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*pow(_q[2][2],2));
-  _V[595]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],3)*_q[2][2]);
-  _V[596]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*_q[4][4]);
-  _V[597]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*_q[4][3]);
-  _V[598]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*_q[4][2]);
-  _V[599]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*_q[4][1]);
-  _V[600]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*_q[3][3]);
-  _V[601]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*_q[3][2]);
-  _V[602]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*_q[3][1]);
-  _V[603]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2)*_q[2][2]);
-  _V[604]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*pow(_q[3][3],2));
-  _V[605]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][2],2)*_q[3][3]);
-  _V[606]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*pow(_q[3][3],2));
-  _V[607]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*pow(_q[3][2],2));
-  _V[608]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][1],2)*_q[3][3]);
-  _V[609]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][1],2)*_q[3][2]);
-  _V[610]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*pow(_q[3][3],2));
-  _V[611]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*pow(_q[3][2],2));
-  _V[612]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*pow(_q[3][1],2));
-  _V[613]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],3)*_q[3][3]);
-  _V[614]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],3)*_q[3][2]);
-  _V[615]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],3)*_q[3][1]);
-  _V[616]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[5][5]);
-  _V[617]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[5][4]);
-  _V[618]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[5][3]);
-  _V[619]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[5][2]);
-  _V[620]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[5][1]);
-  _V[621]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[4][4]);
-  _V[622]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[4][3]);
-  _V[623]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[4][2]);
-  _V[624]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[4][1]);
-  _V[625]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[3][3]);
-  _V[626]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[3][2]);
-  _V[627]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2)*_q[3][1]);
-  _V[628]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*pow(_q[3][3],2));
-  _V[629]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*pow(_q[3][2],2));
-  _V[630]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*pow(_q[3][1],2));
-  _V[631]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*pow(_q[2][2],3));
-  _V[632]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*pow(_q[2][2],2));
-  _V[633]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],3)*_q[3][3]);
-  _V[634]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],3)*_q[3][2]);
-  _V[635]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],3)*_q[3][1]);
-  _V[636]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],3)*_q[2][2]);
-  _V[637]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[5][5]);
-  _V[638]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[5][4]);
-  _V[639]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[5][3]);
-  _V[640]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[5][2]);
-  _V[641]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[5][1]);
-  _V[642]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[4][4]);
-  _V[643]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[4][3]);
-  _V[644]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[4][2]);
-  _V[645]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[4][1]);
-  _V[646]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[3][3]);
-  _V[647]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[3][2]);
-  _V[648]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[3][1]);
-  _V[649]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2)*_q[2][2]);
-  _V[650]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][3],2)*_q[4][4]);
-  _V[651]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][3],2)*_q[4][3]);
-  _V[652]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][3],2)*_q[4][2]);
-  _V[653]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][3],2)*_q[4][1]);
-  _V[654]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*pow(_q[3][3],2));
-  _V[655]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][2],2)*_q[4][4]);
-  _V[656]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][2],2)*_q[4][3]);
-  _V[657]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][2],2)*_q[4][2]);
-  _V[658]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][2],2)*_q[4][1]);
-  _V[659]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][2],2)*_q[3][3]);
-  _V[660]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*pow(_q[3][3],2));
-  _V[661]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*pow(_q[3][2],2));
-  _V[662]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][1],2)*_q[4][4]);
-  _V[663]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][1],2)*_q[4][3]);
-  _V[664]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][1],2)*_q[4][2]);
-  _V[665]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][1],2)*_q[4][1]);
-  _V[666]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][1],2)*_q[3][3]);
-  _V[667]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][1],2)*_q[3][2]);
-  _V[668]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*pow(_q[4][4],2));
-  _V[669]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*pow(_q[4][3],2));
-  _V[670]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*pow(_q[4][2],2));
-  _V[671]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*pow(_q[4][1],2));
-  _V[672]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*pow(_q[3][3],2));
-  _V[673]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*pow(_q[3][2],2));
-  _V[674]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*pow(_q[3][1],2));
-  _V[675]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],3)*_q[4][4]);
-  _V[676]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],3)*_q[4][3]);
-  _V[677]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],3)*_q[4][2]);
-  _V[678]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],3)*_q[4][1]);
-  _V[679]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],3)*_q[3][3]);
-  _V[680]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],3)*_q[3][2]);
-  _V[681]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],3)*_q[3][1]);
-  _V[682]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[6][6]);
-  _V[683]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[6][5]);
-  _V[684]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[6][4]);
-  _V[685]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[6][3]);
-  _V[686]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[6][2]);
-  _V[687]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[6][1]);
-  _V[688]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[5][5]);
-  _V[689]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[5][4]);
-  _V[690]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[5][3]);
-  _V[691]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[5][2]);
-  _V[692]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[5][1]);
-  _V[693]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[4][4]);
-  _V[694]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[4][3]);
-  _V[695]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[4][2]);
-  _V[696]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[4][1]);
-  _V[697]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[3][3]);
-  _V[698]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[3][2]);
-  _V[699]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2)*_q[3][1]);
-  _V[700]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[4][4],2));
-  _V[701]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[4][3],2));
-  _V[702]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[4][2],2));
-  _V[703]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[4][1],2));
-  _V[704]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[3][3],2));
-  _V[705]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[3][2],2));
-  _V[706]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[3][1],2));
-  _V[707]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],4));
-  _V[708]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],3));
-  _V[709]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*pow(_q[2][2],2));
-  _V[710]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],4)*_q[2][2]);
-  _V[711]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*_q[4][4]);
-  _V[712]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*_q[4][3]);
-  _V[713]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*_q[4][2]);
-  _V[714]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*_q[4][1]);
-  _V[715]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*_q[3][3]);
-  _V[716]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*_q[3][2]);
-  _V[717]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*_q[3][1]);
-  _V[718]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3)*_q[2][2]);
-  _V[719]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[6][6]);
-  _V[720]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[6][5]);
-  _V[721]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[6][4]);
-  _V[722]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[6][3]);
-  _V[723]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[6][2]);
-  _V[724]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[6][1]);
-  _V[725]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[5][5]);
-  _V[726]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[5][4]);
-  _V[727]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[5][3]);
-  _V[728]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[5][2]);
-  _V[729]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[5][1]);
-  _V[730]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[4][4]);
-  _V[731]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[4][3]);
-  _V[732]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[4][2]);
-  _V[733]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[4][1]);
-  _V[734]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[3][3]);
-  _V[735]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[3][2]);
-  _V[736]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[3][1]);
-  _V[737]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2)*_q[2][2]);
-  _V[738]->Fill(RefMult, _q[3][1]*_q[3][2]*pow(_q[3][3],2));
-  _V[739]->Fill(RefMult, _q[3][1]*pow(_q[3][2],2)*_q[3][3]);
-  _V[740]->Fill(RefMult, pow(_q[3][1],2)*_q[3][2]*_q[3][3]);
-  _V[741]->Fill(RefMult, _q[2][2]*pow(_q[3][3],2)*_q[4][4]);
-  _V[742]->Fill(RefMult, _q[2][2]*pow(_q[3][3],2)*_q[4][3]);
-  _V[743]->Fill(RefMult, _q[2][2]*pow(_q[3][3],2)*_q[4][2]);
-  _V[744]->Fill(RefMult, _q[2][2]*pow(_q[3][3],2)*_q[4][1]);
-  _V[745]->Fill(RefMult, _q[2][2]*_q[3][2]*pow(_q[3][3],2));
-  _V[746]->Fill(RefMult, _q[2][2]*pow(_q[3][2],2)*_q[4][4]);
-  _V[747]->Fill(RefMult, _q[2][2]*pow(_q[3][2],2)*_q[4][3]);
-  _V[748]->Fill(RefMult, _q[2][2]*pow(_q[3][2],2)*_q[4][2]);
-  _V[749]->Fill(RefMult, _q[2][2]*pow(_q[3][2],2)*_q[4][1]);
-  _V[750]->Fill(RefMult, _q[2][2]*pow(_q[3][2],2)*_q[3][3]);
-  _V[751]->Fill(RefMult, _q[2][2]*_q[3][1]*pow(_q[3][3],2));
-  _V[752]->Fill(RefMult, _q[2][2]*_q[3][1]*pow(_q[3][2],2));
-  _V[753]->Fill(RefMult, _q[2][2]*pow(_q[3][1],2)*_q[4][4]);
-  _V[754]->Fill(RefMult, _q[2][2]*pow(_q[3][1],2)*_q[4][3]);
-  _V[755]->Fill(RefMult, _q[2][2]*pow(_q[3][1],2)*_q[4][2]);
-  _V[756]->Fill(RefMult, _q[2][2]*pow(_q[3][1],2)*_q[4][1]);
-  _V[757]->Fill(RefMult, _q[2][2]*pow(_q[3][1],2)*_q[3][3]);
-  _V[758]->Fill(RefMult, _q[2][2]*pow(_q[3][1],2)*_q[3][2]);
-  _V[759]->Fill(RefMult, pow(_q[2][2],3)*_q[3][2]*_q[3][3]);
-  _V[760]->Fill(RefMult, pow(_q[2][2],3)*_q[3][1]*_q[3][3]);
-  _V[761]->Fill(RefMult, pow(_q[2][2],3)*_q[3][1]*_q[3][2]);
-  _V[762]->Fill(RefMult, pow(_q[2][2],2)*_q[4][3]*_q[4][4]);
-  _V[763]->Fill(RefMult, pow(_q[2][2],2)*_q[4][2]*_q[4][4]);
-  _V[764]->Fill(RefMult, pow(_q[2][2],2)*_q[4][2]*_q[4][3]);
-  _V[765]->Fill(RefMult, pow(_q[2][2],2)*_q[4][1]*_q[4][4]);
-  _V[766]->Fill(RefMult, pow(_q[2][2],2)*_q[4][1]*_q[4][3]);
-  _V[767]->Fill(RefMult, pow(_q[2][2],2)*_q[4][1]*_q[4][2]);
-  _V[768]->Fill(RefMult, pow(_q[2][2],2)*_q[3][3]*_q[4][4]);
-  _V[769]->Fill(RefMult, pow(_q[2][2],2)*_q[3][3]*_q[4][3]);
-  _V[770]->Fill(RefMult, pow(_q[2][2],2)*_q[3][3]*_q[4][2]);
-  _V[771]->Fill(RefMult, pow(_q[2][2],2)*_q[3][3]*_q[4][1]);
-  _V[772]->Fill(RefMult, pow(_q[2][2],2)*_q[3][2]*_q[4][4]);
-  _V[773]->Fill(RefMult, pow(_q[2][2],2)*_q[3][2]*_q[4][3]);
-  _V[774]->Fill(RefMult, pow(_q[2][2],2)*_q[3][2]*_q[4][2]);
-  _V[775]->Fill(RefMult, pow(_q[2][2],2)*_q[3][2]*_q[4][1]);
-  _V[776]->Fill(RefMult, pow(_q[2][2],2)*_q[3][2]*_q[3][3]);
-  _V[777]->Fill(RefMult, pow(_q[2][2],2)*_q[3][1]*_q[4][4]);
-  _V[778]->Fill(RefMult, pow(_q[2][2],2)*_q[3][1]*_q[4][3]);
-  _V[779]->Fill(RefMult, pow(_q[2][2],2)*_q[3][1]*_q[4][2]);
-  _V[780]->Fill(RefMult, pow(_q[2][2],2)*_q[3][1]*_q[4][1]);
-  _V[781]->Fill(RefMult, pow(_q[2][2],2)*_q[3][1]*_q[3][3]);
-  _V[782]->Fill(RefMult, pow(_q[2][2],2)*_q[3][1]*_q[3][2]);
-  _V[783]->Fill(RefMult, _q[2][1]*pow(_q[3][3],2)*_q[4][4]);
-  _V[784]->Fill(RefMult, _q[2][1]*pow(_q[3][3],2)*_q[4][3]);
-  _V[785]->Fill(RefMult, _q[2][1]*pow(_q[3][3],2)*_q[4][2]);
-  _V[786]->Fill(RefMult, _q[2][1]*pow(_q[3][3],2)*_q[4][1]);
-  _V[787]->Fill(RefMult, _q[2][1]*_q[3][2]*pow(_q[3][3],2));
-  _V[788]->Fill(RefMult, _q[2][1]*pow(_q[3][2],2)*_q[4][4]);
-  _V[789]->Fill(RefMult, _q[2][1]*pow(_q[3][2],2)*_q[4][3]);
-  _V[790]->Fill(RefMult, _q[2][1]*pow(_q[3][2],2)*_q[4][2]);
-  _V[791]->Fill(RefMult, _q[2][1]*pow(_q[3][2],2)*_q[4][1]);
-  _V[792]->Fill(RefMult, _q[2][1]*pow(_q[3][2],2)*_q[3][3]);
-  _V[793]->Fill(RefMult, _q[2][1]*_q[3][1]*pow(_q[3][3],2));
-  _V[794]->Fill(RefMult, _q[2][1]*_q[3][1]*pow(_q[3][2],2));
-  _V[795]->Fill(RefMult, _q[2][1]*pow(_q[3][1],2)*_q[4][4]);
-  _V[796]->Fill(RefMult, _q[2][1]*pow(_q[3][1],2)*_q[4][3]);
-  _V[797]->Fill(RefMult, _q[2][1]*pow(_q[3][1],2)*_q[4][2]);
-  _V[798]->Fill(RefMult, _q[2][1]*pow(_q[3][1],2)*_q[4][1]);
-  _V[799]->Fill(RefMult, _q[2][1]*pow(_q[3][1],2)*_q[3][3]);
-  _V[800]->Fill(RefMult, _q[2][1]*pow(_q[3][1],2)*_q[3][2]);
-  _V[801]->Fill(RefMult, _q[2][1]*_q[2][2]*pow(_q[4][4],2));
-  _V[802]->Fill(RefMult, _q[2][1]*_q[2][2]*pow(_q[4][3],2));
-  _V[803]->Fill(RefMult, _q[2][1]*_q[2][2]*pow(_q[4][2],2));
-  _V[804]->Fill(RefMult, _q[2][1]*_q[2][2]*pow(_q[4][1],2));
-  _V[805]->Fill(RefMult, _q[2][1]*_q[2][2]*pow(_q[3][3],2));
-  _V[806]->Fill(RefMult, _q[2][1]*_q[2][2]*pow(_q[3][2],2));
-  _V[807]->Fill(RefMult, _q[2][1]*_q[2][2]*pow(_q[3][1],2));
-  _V[808]->Fill(RefMult, _q[2][1]*pow(_q[2][2],3)*_q[4][4]);
-  _V[809]->Fill(RefMult, _q[2][1]*pow(_q[2][2],3)*_q[4][3]);
-  _V[810]->Fill(RefMult, _q[2][1]*pow(_q[2][2],3)*_q[4][2]);
-  _V[811]->Fill(RefMult, _q[2][1]*pow(_q[2][2],3)*_q[4][1]);
-  _V[812]->Fill(RefMult, _q[2][1]*pow(_q[2][2],3)*_q[3][3]);
-  _V[813]->Fill(RefMult, _q[2][1]*pow(_q[2][2],3)*_q[3][2]);
-  _V[814]->Fill(RefMult, _q[2][1]*pow(_q[2][2],3)*_q[3][1]);
-  _V[815]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[6][6]);
-  _V[816]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[6][5]);
-  _V[817]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[6][4]);
-  _V[818]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[6][3]);
-  _V[819]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[6][2]);
-  _V[820]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[6][1]);
-  _V[821]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[5][5]);
-  _V[822]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[5][4]);
-  _V[823]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[5][3]);
-  _V[824]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[5][2]);
-  _V[825]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[5][1]);
-  _V[826]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[4][4]);
-  _V[827]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[4][3]);
-  _V[828]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[4][2]);
-  _V[829]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[4][1]);
-  _V[830]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[3][3]);
-  _V[831]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[3][2]);
-  _V[832]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2)*_q[3][1]);
-  _V[833]->Fill(RefMult, pow(_q[2][1],3)*_q[3][2]*_q[3][3]);
-  _V[834]->Fill(RefMult, pow(_q[2][1],3)*_q[3][1]*_q[3][3]);
-  _V[835]->Fill(RefMult, pow(_q[2][1],3)*_q[3][1]*_q[3][2]);
-  _V[836]->Fill(RefMult, pow(_q[2][1],3)*_q[2][2]*_q[4][4]);
-  _V[837]->Fill(RefMult, pow(_q[2][1],3)*_q[2][2]*_q[4][3]);
-  _V[838]->Fill(RefMult, pow(_q[2][1],3)*_q[2][2]*_q[4][2]);
-  _V[839]->Fill(RefMult, pow(_q[2][1],3)*_q[2][2]*_q[4][1]);
-  _V[840]->Fill(RefMult, pow(_q[2][1],3)*_q[2][2]*_q[3][3]);
-  _V[841]->Fill(RefMult, pow(_q[2][1],3)*_q[2][2]*_q[3][2]);
-  _V[842]->Fill(RefMult, pow(_q[2][1],3)*_q[2][2]*_q[3][1]);
-  _V[843]->Fill(RefMult, pow(_q[2][1],2)*_q[4][3]*_q[4][4]);
-  _V[844]->Fill(RefMult, pow(_q[2][1],2)*_q[4][2]*_q[4][4]);
-  _V[845]->Fill(RefMult, pow(_q[2][1],2)*_q[4][2]*_q[4][3]);
-  _V[846]->Fill(RefMult, pow(_q[2][1],2)*_q[4][1]*_q[4][4]);
-  _V[847]->Fill(RefMult, pow(_q[2][1],2)*_q[4][1]*_q[4][3]);
-  _V[848]->Fill(RefMult, pow(_q[2][1],2)*_q[4][1]*_q[4][2]);
-  _V[849]->Fill(RefMult, pow(_q[2][1],2)*_q[3][3]*_q[4][4]);
-  _V[850]->Fill(RefMult, pow(_q[2][1],2)*_q[3][3]*_q[4][3]);
-  _V[851]->Fill(RefMult, pow(_q[2][1],2)*_q[3][3]*_q[4][2]);
-  _V[852]->Fill(RefMult, pow(_q[2][1],2)*_q[3][3]*_q[4][1]);
-  _V[853]->Fill(RefMult, pow(_q[2][1],2)*_q[3][2]*_q[4][4]);
-  _V[854]->Fill(RefMult, pow(_q[2][1],2)*_q[3][2]*_q[4][3]);
-  _V[855]->Fill(RefMult, pow(_q[2][1],2)*_q[3][2]*_q[4][2]);
-  _V[856]->Fill(RefMult, pow(_q[2][1],2)*_q[3][2]*_q[4][1]);
-  _V[857]->Fill(RefMult, pow(_q[2][1],2)*_q[3][2]*_q[3][3]);
-  _V[858]->Fill(RefMult, pow(_q[2][1],2)*_q[3][1]*_q[4][4]);
-  _V[859]->Fill(RefMult, pow(_q[2][1],2)*_q[3][1]*_q[4][3]);
-  _V[860]->Fill(RefMult, pow(_q[2][1],2)*_q[3][1]*_q[4][2]);
-  _V[861]->Fill(RefMult, pow(_q[2][1],2)*_q[3][1]*_q[4][1]);
-  _V[862]->Fill(RefMult, pow(_q[2][1],2)*_q[3][1]*_q[3][3]);
-  _V[863]->Fill(RefMult, pow(_q[2][1],2)*_q[3][1]*_q[3][2]);
-  _V[864]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[6][6]);
-  _V[865]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[6][5]);
-  _V[866]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[6][4]);
-  _V[867]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[6][3]);
-  _V[868]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[6][2]);
-  _V[869]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[6][1]);
-  _V[870]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[5][5]);
-  _V[871]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[5][4]);
-  _V[872]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[5][3]);
-  _V[873]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[5][2]);
-  _V[874]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[5][1]);
-  _V[875]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[4][4]);
-  _V[876]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[4][3]);
-  _V[877]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[4][2]);
-  _V[878]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[4][1]);
-  _V[879]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[3][3]);
-  _V[880]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[3][2]);
-  _V[881]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]*_q[3][1]);
-  _V[882]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[5][5]);
-  _V[883]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[5][4]);
-  _V[884]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[5][3]);
-  _V[885]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[5][2]);
-  _V[886]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[5][1]);
-  _V[887]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[4][4]);
-  _V[888]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[4][3]);
-  _V[889]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[4][2]);
-  _V[890]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2)*_q[4][1]);
-  _V[891]->Fill(RefMult, _q[1][1]*_q[3][2]*pow(_q[3][3],2));
-  _V[892]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[5][5]);
-  _V[893]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[5][4]);
-  _V[894]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[5][3]);
-  _V[895]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[5][2]);
-  _V[896]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[5][1]);
-  _V[897]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[4][4]);
-  _V[898]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[4][3]);
-  _V[899]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[4][2]);
-  _V[900]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[4][1]);
-  _V[901]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2)*_q[3][3]);
-  _V[902]->Fill(RefMult, _q[1][1]*_q[3][1]*pow(_q[3][3],2));
-  _V[903]->Fill(RefMult, _q[1][1]*_q[3][1]*pow(_q[3][2],2));
-  _V[904]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[5][5]);
-  _V[905]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[5][4]);
-  _V[906]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[5][3]);
-  _V[907]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[5][2]);
-  _V[908]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[5][1]);
-  _V[909]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[4][4]);
-  _V[910]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[4][3]);
-  _V[911]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[4][2]);
-  _V[912]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[4][1]);
-  _V[913]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[3][3]);
-  _V[914]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2)*_q[3][2]);
-  _V[915]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[4][4],2));
-  _V[916]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[4][3],2));
-  _V[917]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[4][2],2));
-  _V[918]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[4][1],2));
-  _V[919]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][3],3));
-  _V[920]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][3],2));
-  _V[921]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][2],3));
-  _V[922]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][2],2));
-  _V[923]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][1],3));
-  _V[924]->Fill(RefMult, _q[1][1]*_q[2][2]*pow(_q[3][1],2));
-  _V[925]->Fill(RefMult, _q[1][1]*pow(_q[2][2],4)*_q[3][3]);
-  _V[926]->Fill(RefMult, _q[1][1]*pow(_q[2][2],4)*_q[3][2]);
-  _V[927]->Fill(RefMult, _q[1][1]*pow(_q[2][2],4)*_q[3][1]);
-  _V[928]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[5][5]);
-  _V[929]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[5][4]);
-  _V[930]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[5][3]);
-  _V[931]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[5][2]);
-  _V[932]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[5][1]);
-  _V[933]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[4][4]);
-  _V[934]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[4][3]);
-  _V[935]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[4][2]);
-  _V[936]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[4][1]);
-  _V[937]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[3][3]);
-  _V[938]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[3][2]);
-  _V[939]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3)*_q[3][1]);
-  _V[940]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[6][6]);
-  _V[941]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[6][5]);
-  _V[942]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[6][4]);
-  _V[943]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[6][3]);
-  _V[944]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[6][2]);
-  _V[945]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[6][1]);
-  _V[946]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[5][5]);
-  _V[947]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[5][4]);
-  _V[948]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[5][3]);
-  _V[949]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[5][2]);
-  _V[950]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[5][1]);
-  _V[951]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[4][4]);
-  _V[952]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[4][3]);
-  _V[953]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[4][2]);
-  _V[954]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[4][1]);
-  _V[955]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][3]);
-  _V[956]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][2]);
-  _V[957]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2)*_q[3][1]);
-  _V[958]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[4][4],2));
-  _V[959]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[4][3],2));
-  _V[960]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[4][2],2));
-  _V[961]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[4][1],2));
-  _V[962]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][3],3));
-  _V[963]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][3],2));
-  _V[964]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][2],3));
-  _V[965]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][2],2));
-  _V[966]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][1],3));
-  _V[967]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[3][1],2));
-  _V[968]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],4));
-  _V[969]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],3));
-  _V[970]->Fill(RefMult, _q[1][1]*_q[2][1]*pow(_q[2][2],2));
-  _V[971]->Fill(RefMult, _q[1][1]*pow(_q[2][1],4)*_q[3][3]);
-  _V[972]->Fill(RefMult, _q[1][1]*pow(_q[2][1],4)*_q[3][2]);
-  _V[973]->Fill(RefMult, _q[1][1]*pow(_q[2][1],4)*_q[3][1]);
-  _V[974]->Fill(RefMult, _q[1][1]*pow(_q[2][1],4)*_q[2][2]);
-  _V[975]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[5][5]);
-  _V[976]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[5][4]);
-  _V[977]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[5][3]);
-  _V[978]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[5][2]);
-  _V[979]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[5][1]);
-  _V[980]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[4][4]);
-  _V[981]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[4][3]);
-  _V[982]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[4][2]);
-  _V[983]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[4][1]);
-  _V[984]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[3][3]);
-  _V[985]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[3][2]);
-  _V[986]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[3][1]);
-  _V[987]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3)*_q[2][2]);
-  _V[988]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[6][6]);
-  _V[989]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[6][5]);
-  _V[990]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[6][4]);
-  _V[991]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[6][3]);
-  _V[992]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[6][2]);
-  _V[993]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[6][1]);
-  _V[994]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[5][5]);
-  _V[995]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[5][4]);
-  _V[996]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[5][3]);
-  _V[997]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[5][2]);
-  _V[998]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[5][1]);
-  _V[999]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[4][4]);
-  _V[1000]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[4][3]);
-  _V[1001]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[4][2]);
-  _V[1002]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[4][1]);
-  _V[1003]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][3]);
-  _V[1004]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][2]);
-  _V[1005]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[3][1]);
-  _V[1006]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2)*_q[2][2]);
-  _V[1007]->Fill(RefMult, pow(_q[1][1],8)*_q[2][1]*_q[2][2]);
-  _V[1008]->Fill(RefMult, pow(_q[1][1],7)*_q[2][2]*_q[3][3]);
-  _V[1009]->Fill(RefMult, pow(_q[1][1],7)*_q[2][2]*_q[3][2]);
-  _V[1010]->Fill(RefMult, pow(_q[1][1],7)*_q[2][2]*_q[3][1]);
-  _V[1011]->Fill(RefMult, pow(_q[1][1],7)*_q[2][1]*_q[3][3]);
-  _V[1012]->Fill(RefMult, pow(_q[1][1],7)*_q[2][1]*_q[3][2]);
-  _V[1013]->Fill(RefMult, pow(_q[1][1],7)*_q[2][1]*_q[3][1]);
-  _V[1014]->Fill(RefMult, pow(_q[1][1],7)*_q[2][1]*_q[2][2]);
-  _V[1015]->Fill(RefMult, pow(_q[1][1],6)*_q[3][2]*_q[3][3]);
-  _V[1016]->Fill(RefMult, pow(_q[1][1],6)*_q[3][1]*_q[3][3]);
-  _V[1017]->Fill(RefMult, pow(_q[1][1],6)*_q[3][1]*_q[3][2]);
-  _V[1018]->Fill(RefMult, pow(_q[1][1],6)*_q[2][2]*_q[4][4]);
-  _V[1019]->Fill(RefMult, pow(_q[1][1],6)*_q[2][2]*_q[4][3]);
-  _V[1020]->Fill(RefMult, pow(_q[1][1],6)*_q[2][2]*_q[4][2]);
-  _V[1021]->Fill(RefMult, pow(_q[1][1],6)*_q[2][2]*_q[4][1]);
-  _V[1022]->Fill(RefMult, pow(_q[1][1],6)*_q[2][2]*_q[3][3]);
-  _V[1023]->Fill(RefMult, pow(_q[1][1],6)*_q[2][2]*_q[3][2]);
-  _V[1024]->Fill(RefMult, pow(_q[1][1],6)*_q[2][2]*_q[3][1]);
-  _V[1025]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*_q[4][4]);
-  _V[1026]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*_q[4][3]);
-  _V[1027]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*_q[4][2]);
-  _V[1028]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*_q[4][1]);
-  _V[1029]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*_q[3][3]);
-  _V[1030]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*_q[3][2]);
-  _V[1031]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*_q[3][1]);
-  _V[1032]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]*_q[2][2]);
-  _V[1033]->Fill(RefMult, pow(_q[1][1],5)*_q[3][3]*_q[4][4]);
-  _V[1034]->Fill(RefMult, pow(_q[1][1],5)*_q[3][3]*_q[4][3]);
-  _V[1035]->Fill(RefMult, pow(_q[1][1],5)*_q[3][3]*_q[4][2]);
-  _V[1036]->Fill(RefMult, pow(_q[1][1],5)*_q[3][3]*_q[4][1]);
-  _V[1037]->Fill(RefMult, pow(_q[1][1],5)*_q[3][2]*_q[4][4]);
-  _V[1038]->Fill(RefMult, pow(_q[1][1],5)*_q[3][2]*_q[4][3]);
-  _V[1039]->Fill(RefMult, pow(_q[1][1],5)*_q[3][2]*_q[4][2]);
-  _V[1040]->Fill(RefMult, pow(_q[1][1],5)*_q[3][2]*_q[4][1]);
-  _V[1041]->Fill(RefMult, pow(_q[1][1],5)*_q[3][2]*_q[3][3]);
-  _V[1042]->Fill(RefMult, pow(_q[1][1],5)*_q[3][1]*_q[4][4]);
-  _V[1043]->Fill(RefMult, pow(_q[1][1],5)*_q[3][1]*_q[4][3]);
-  _V[1044]->Fill(RefMult, pow(_q[1][1],5)*_q[3][1]*_q[4][2]);
-  _V[1045]->Fill(RefMult, pow(_q[1][1],5)*_q[3][1]*_q[4][1]);
-  _V[1046]->Fill(RefMult, pow(_q[1][1],5)*_q[3][1]*_q[3][3]);
-  _V[1047]->Fill(RefMult, pow(_q[1][1],5)*_q[3][1]*_q[3][2]);
-  _V[1048]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[5][5]);
-  _V[1049]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[5][4]);
-  _V[1050]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[5][3]);
-  _V[1051]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[5][2]);
-  _V[1052]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[5][1]);
-  _V[1053]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[4][4]);
-  _V[1054]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[4][3]);
-  _V[1055]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[4][2]);
-  _V[1056]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[4][1]);
-  _V[1057]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[3][3]);
-  _V[1058]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[3][2]);
-  _V[1059]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]*_q[3][1]);
-  _V[1060]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[5][5]);
-  _V[1061]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[5][4]);
-  _V[1062]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[5][3]);
-  _V[1063]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[5][2]);
-  _V[1064]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[5][1]);
-  _V[1065]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[4][4]);
-  _V[1066]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[4][3]);
-  _V[1067]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[4][2]);
-  _V[1068]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[4][1]);
-  _V[1069]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[3][3]);
-  _V[1070]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[3][2]);
-  _V[1071]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[3][1]);
-  _V[1072]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]*_q[2][2]);
-  _V[1073]->Fill(RefMult, pow(_q[1][1],4)*_q[4][3]*_q[4][4]);
-  _V[1074]->Fill(RefMult, pow(_q[1][1],4)*_q[4][2]*_q[4][4]);
-  _V[1075]->Fill(RefMult, pow(_q[1][1],4)*_q[4][2]*_q[4][3]);
-  _V[1076]->Fill(RefMult, pow(_q[1][1],4)*_q[4][1]*_q[4][4]);
-  _V[1077]->Fill(RefMult, pow(_q[1][1],4)*_q[4][1]*_q[4][3]);
-  _V[1078]->Fill(RefMult, pow(_q[1][1],4)*_q[4][1]*_q[4][2]);
-  _V[1079]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[5][5]);
-  _V[1080]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[5][4]);
-  _V[1081]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[5][3]);
-  _V[1082]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[5][2]);
-  _V[1083]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[5][1]);
-  _V[1084]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[4][4]);
-  _V[1085]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[4][3]);
-  _V[1086]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[4][2]);
-  _V[1087]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]*_q[4][1]);
-  _V[1088]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[5][5]);
-  _V[1089]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[5][4]);
-  _V[1090]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[5][3]);
-  _V[1091]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[5][2]);
-  _V[1092]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[5][1]);
-  _V[1093]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[4][4]);
-  _V[1094]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[4][3]);
-  _V[1095]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[4][2]);
-  _V[1096]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[4][1]);
-  _V[1097]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]*_q[3][3]);
-  _V[1098]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[5][5]);
-  _V[1099]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[5][4]);
-  _V[1100]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[5][3]);
-  _V[1101]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[5][2]);
-  _V[1102]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[5][1]);
-  _V[1103]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[4][4]);
-  _V[1104]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[4][3]);
-  _V[1105]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[4][2]);
-  _V[1106]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[4][1]);
-  _V[1107]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[3][3]);
-  _V[1108]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]*_q[3][2]);
-  _V[1109]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[6][6]);
-  _V[1110]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[6][5]);
-  _V[1111]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[6][4]);
-  _V[1112]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[6][3]);
-  _V[1113]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[6][2]);
-  _V[1114]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[6][1]);
-  _V[1115]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[5][5]);
-  _V[1116]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[5][4]);
-  _V[1117]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[5][3]);
-  _V[1118]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[5][2]);
-  _V[1119]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[5][1]);
-  _V[1120]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[4][4]);
-  _V[1121]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[4][3]);
-  _V[1122]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[4][2]);
-  _V[1123]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[4][1]);
-  _V[1124]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[3][3]);
-  _V[1125]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[3][2]);
-  _V[1126]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]*_q[3][1]);
-  _V[1127]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[6][6]);
-  _V[1128]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[6][5]);
-  _V[1129]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[6][4]);
-  _V[1130]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[6][3]);
-  _V[1131]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[6][2]);
-  _V[1132]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[6][1]);
-  _V[1133]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[5][5]);
-  _V[1134]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[5][4]);
-  _V[1135]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[5][3]);
-  _V[1136]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[5][2]);
-  _V[1137]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[5][1]);
-  _V[1138]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[4][4]);
-  _V[1139]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[4][3]);
-  _V[1140]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[4][2]);
-  _V[1141]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[4][1]);
-  _V[1142]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[3][3]);
-  _V[1143]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[3][2]);
-  _V[1144]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[3][1]);
-  _V[1145]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]*_q[2][2]);
-  _V[1146]->Fill(RefMult, pow(_q[1][1],3)*_q[4][4]*_q[5][5]);
-  _V[1147]->Fill(RefMult, pow(_q[1][1],3)*_q[4][4]*_q[5][4]);
-  _V[1148]->Fill(RefMult, pow(_q[1][1],3)*_q[4][4]*_q[5][3]);
-  _V[1149]->Fill(RefMult, pow(_q[1][1],3)*_q[4][4]*_q[5][2]);
-  _V[1150]->Fill(RefMult, pow(_q[1][1],3)*_q[4][4]*_q[5][1]);
-  _V[1151]->Fill(RefMult, pow(_q[1][1],3)*_q[4][3]*_q[5][5]);
-  _V[1152]->Fill(RefMult, pow(_q[1][1],3)*_q[4][3]*_q[5][4]);
-  _V[1153]->Fill(RefMult, pow(_q[1][1],3)*_q[4][3]*_q[5][3]);
-  _V[1154]->Fill(RefMult, pow(_q[1][1],3)*_q[4][3]*_q[5][2]);
-  _V[1155]->Fill(RefMult, pow(_q[1][1],3)*_q[4][3]*_q[5][1]);
-  _V[1156]->Fill(RefMult, pow(_q[1][1],3)*_q[4][3]*_q[4][4]);
-  _V[1157]->Fill(RefMult, pow(_q[1][1],3)*_q[4][2]*_q[5][5]);
-  _V[1158]->Fill(RefMult, pow(_q[1][1],3)*_q[4][2]*_q[5][4]);
-  _V[1159]->Fill(RefMult, pow(_q[1][1],3)*_q[4][2]*_q[5][3]);
-  _V[1160]->Fill(RefMult, pow(_q[1][1],3)*_q[4][2]*_q[5][2]);
-  _V[1161]->Fill(RefMult, pow(_q[1][1],3)*_q[4][2]*_q[5][1]);
-  _V[1162]->Fill(RefMult, pow(_q[1][1],3)*_q[4][2]*_q[4][4]);
-  _V[1163]->Fill(RefMult, pow(_q[1][1],3)*_q[4][2]*_q[4][3]);
-  _V[1164]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]*_q[5][5]);
-  _V[1165]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]*_q[5][4]);
-  _V[1166]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]*_q[5][3]);
-  _V[1167]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]*_q[5][2]);
-  _V[1168]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]*_q[5][1]);
-  _V[1169]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]*_q[4][4]);
-  _V[1170]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]*_q[4][3]);
-  _V[1171]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]*_q[4][2]);
-  _V[1172]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[6][6]);
-  _V[1173]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[6][5]);
-  _V[1174]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[6][4]);
-  _V[1175]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[6][3]);
-  _V[1176]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[6][2]);
-  _V[1177]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[6][1]);
-  _V[1178]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[5][5]);
-  _V[1179]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[5][4]);
-  _V[1180]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[5][3]);
-  _V[1181]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[5][2]);
-  _V[1182]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[5][1]);
-  _V[1183]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[4][4]);
-  _V[1184]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[4][3]);
-  _V[1185]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[4][2]);
-  _V[1186]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]*_q[4][1]);
-  _V[1187]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[6][6]);
-  _V[1188]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[6][5]);
-  _V[1189]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[6][4]);
-  _V[1190]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[6][3]);
-  _V[1191]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[6][2]);
-  _V[1192]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[6][1]);
-  _V[1193]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[5][5]);
-  _V[1194]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[5][4]);
-  _V[1195]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[5][3]);
-  _V[1196]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[5][2]);
-  _V[1197]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[5][1]);
-  _V[1198]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[4][4]);
-  _V[1199]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[4][3]);
-  _V[1200]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[4][2]);
-  _V[1201]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[4][1]);
-  _V[1202]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]*_q[3][3]);
-  _V[1203]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[6][6]);
-  _V[1204]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[6][5]);
-  _V[1205]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[6][4]);
-  _V[1206]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[6][3]);
-  _V[1207]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[6][2]);
-  _V[1208]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[6][1]);
-  _V[1209]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[5][5]);
-  _V[1210]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[5][4]);
-  _V[1211]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[5][3]);
-  _V[1212]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[5][2]);
-  _V[1213]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[5][1]);
-  _V[1214]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[4][4]);
-  _V[1215]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[4][3]);
-  _V[1216]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[4][2]);
-  _V[1217]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[4][1]);
-  _V[1218]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[3][3]);
-  _V[1219]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]*_q[3][2]);
-  _V[1220]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[6][6]);
-  _V[1221]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[6][5]);
-  _V[1222]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[6][4]);
-  _V[1223]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[6][3]);
-  _V[1224]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[6][2]);
-  _V[1225]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[6][1]);
-  _V[1226]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[5][5]);
-  _V[1227]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[5][4]);
-  _V[1228]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[5][3]);
-  _V[1229]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[5][2]);
-  _V[1230]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[5][1]);
-  _V[1231]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[4][4]);
-  _V[1232]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[4][3]);
-  _V[1233]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[4][2]);
-  _V[1234]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[4][1]);
-  _V[1235]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][3]);
-  _V[1236]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][2]);
-  _V[1237]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]*_q[3][1]);
-  _V[1238]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[6][6]);
-  _V[1239]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[6][5]);
-  _V[1240]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[6][4]);
-  _V[1241]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[6][3]);
-  _V[1242]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[6][2]);
-  _V[1243]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[6][1]);
-  _V[1244]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[5][5]);
-  _V[1245]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[5][4]);
-  _V[1246]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[5][3]);
-  _V[1247]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[5][2]);
-  _V[1248]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[5][1]);
-  _V[1249]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[4][4]);
-  _V[1250]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[4][3]);
-  _V[1251]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[4][2]);
-  _V[1252]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[4][1]);
-  _V[1253]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][3]);
-  _V[1254]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][2]);
-  _V[1255]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[3][1]);
-  _V[1256]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]*_q[2][2]);
-  _V[1257]->Fill(RefMult, pow(_q[1][1],2)*_q[5][4]*_q[5][5]);
-  _V[1258]->Fill(RefMult, pow(_q[1][1],2)*_q[5][3]*_q[5][5]);
-  _V[1259]->Fill(RefMult, pow(_q[1][1],2)*_q[5][3]*_q[5][4]);
-  _V[1260]->Fill(RefMult, pow(_q[1][1],2)*_q[5][2]*_q[5][5]);
-  _V[1261]->Fill(RefMult, pow(_q[1][1],2)*_q[5][2]*_q[5][4]);
-  _V[1262]->Fill(RefMult, pow(_q[1][1],2)*_q[5][2]*_q[5][3]);
-  _V[1263]->Fill(RefMult, pow(_q[1][1],2)*_q[5][1]*_q[5][5]);
-  _V[1264]->Fill(RefMult, pow(_q[1][1],2)*_q[5][1]*_q[5][4]);
-  _V[1265]->Fill(RefMult, pow(_q[1][1],2)*_q[5][1]*_q[5][3]);
-  _V[1266]->Fill(RefMult, pow(_q[1][1],2)*_q[5][1]*_q[5][2]);
-  _V[1267]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[6][6]);
-  _V[1268]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[6][5]);
-  _V[1269]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[6][4]);
-  _V[1270]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[6][3]);
-  _V[1271]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[6][2]);
-  _V[1272]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[6][1]);
-  _V[1273]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[5][5]);
-  _V[1274]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[5][4]);
-  _V[1275]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[5][3]);
-  _V[1276]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[5][2]);
-  _V[1277]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]*_q[5][1]);
-  _V[1278]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[6][6]);
-  _V[1279]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[6][5]);
-  _V[1280]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[6][4]);
-  _V[1281]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[6][3]);
-  _V[1282]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[6][2]);
-  _V[1283]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[6][1]);
-  _V[1284]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[5][5]);
-  _V[1285]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[5][4]);
-  _V[1286]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[5][3]);
-  _V[1287]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[5][2]);
-  _V[1288]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[5][1]);
-  _V[1289]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]*_q[4][4]);
-  _V[1290]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[6][6]);
-  _V[1291]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[6][5]);
-  _V[1292]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[6][4]);
-  _V[1293]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[6][3]);
-  _V[1294]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[6][2]);
-  _V[1295]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[6][1]);
-  _V[1296]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[5][5]);
-  _V[1297]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[5][4]);
-  _V[1298]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[5][3]);
-  _V[1299]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[5][2]);
-  _V[1300]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[5][1]);
-  _V[1301]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[4][4]);
-  _V[1302]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]*_q[4][3]);
-  _V[1303]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[6][6]);
-  _V[1304]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[6][5]);
-  _V[1305]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[6][4]);
-  _V[1306]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[6][3]);
-  _V[1307]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[6][2]);
-  _V[1308]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[6][1]);
-  _V[1309]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[5][5]);
-  _V[1310]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[5][4]);
-  _V[1311]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[5][3]);
-  _V[1312]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[5][2]);
-  _V[1313]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[5][1]);
-  _V[1314]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[4][4]);
-  _V[1315]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[4][3]);
-  _V[1316]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]*_q[4][2]);
-  _V[1317]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[6][6]);
-  _V[1318]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[6][5]);
-  _V[1319]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[6][4]);
-  _V[1320]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[6][3]);
-  _V[1321]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[6][2]);
-  _V[1322]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[6][1]);
-  _V[1323]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[5][5]);
-  _V[1324]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[5][4]);
-  _V[1325]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[5][3]);
-  _V[1326]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[5][2]);
-  _V[1327]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[5][1]);
-  _V[1328]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[4][4]);
-  _V[1329]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[4][3]);
-  _V[1330]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[4][2]);
-  _V[1331]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]*_q[4][1]);
-  _V[1332]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[6][6]);
-  _V[1333]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[6][5]);
-  _V[1334]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[6][4]);
-  _V[1335]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[6][3]);
-  _V[1336]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[6][2]);
-  _V[1337]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[6][1]);
-  _V[1338]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[5][5]);
-  _V[1339]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[5][4]);
-  _V[1340]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[5][3]);
-  _V[1341]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[5][2]);
-  _V[1342]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[5][1]);
-  _V[1343]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[4][4]);
-  _V[1344]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[4][3]);
-  _V[1345]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[4][2]);
-  _V[1346]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[4][1]);
-  _V[1347]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]*_q[3][3]);
-  _V[1348]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[6][6]);
-  _V[1349]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[6][5]);
-  _V[1350]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[6][4]);
-  _V[1351]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[6][3]);
-  _V[1352]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[6][2]);
-  _V[1353]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[6][1]);
-  _V[1354]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[5][5]);
-  _V[1355]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[5][4]);
-  _V[1356]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[5][3]);
-  _V[1357]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[5][2]);
-  _V[1358]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[5][1]);
-  _V[1359]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[4][4]);
-  _V[1360]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[4][3]);
-  _V[1361]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[4][2]);
-  _V[1362]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[4][1]);
-  _V[1363]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][3]);
-  _V[1364]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]*_q[3][2]);
-  _V[1365]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[6][6]);
-  _V[1366]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[6][5]);
-  _V[1367]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[6][4]);
-  _V[1368]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[6][3]);
-  _V[1369]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[6][2]);
-  _V[1370]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[6][1]);
-  _V[1371]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[5][5]);
-  _V[1372]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[5][4]);
-  _V[1373]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[5][3]);
-  _V[1374]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[5][2]);
-  _V[1375]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[5][1]);
-  _V[1376]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][4]);
-  _V[1377]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][3]);
-  _V[1378]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][2]);
-  _V[1379]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[4][1]);
-  _V[1380]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][3]);
-  _V[1381]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][2]);
-  _V[1382]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]*_q[3][1]);
-  _V[1383]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[6][6]);
-  _V[1384]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[6][5]);
-  _V[1385]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[6][4]);
-  _V[1386]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[6][3]);
-  _V[1387]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[6][2]);
-  _V[1388]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[6][1]);
-  _V[1389]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[5][5]);
-  _V[1390]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[5][4]);
-  _V[1391]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[5][3]);
-  _V[1392]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[5][2]);
-  _V[1393]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[5][1]);
-  _V[1394]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][4]);
-  _V[1395]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][3]);
-  _V[1396]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][2]);
-  _V[1397]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[4][1]);
-  _V[1398]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][3]);
-  _V[1399]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][2]);
-  _V[1400]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[3][1]);
-  _V[1401]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]*_q[2][2]);
-  _V[1402]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[6][6]);
-  _V[1403]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[6][5]);
-  _V[1404]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[6][4]);
-  _V[1405]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[6][3]);
-  _V[1406]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[6][2]);
-  _V[1407]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[6][1]);
-  _V[1408]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[5][5]);
-  _V[1409]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[5][4]);
-  _V[1410]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[5][3]);
-  _V[1411]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[5][2]);
-  _V[1412]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[5][1]);
-  _V[1413]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[4][4]);
-  _V[1414]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[4][3]);
-  _V[1415]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[4][2]);
-  _V[1416]->Fill(RefMult, _q[3][2]*_q[3][3]*_q[4][1]);
-  _V[1417]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[6][6]);
-  _V[1418]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[6][5]);
-  _V[1419]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[6][4]);
-  _V[1420]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[6][3]);
-  _V[1421]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[6][2]);
-  _V[1422]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[6][1]);
-  _V[1423]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[5][5]);
-  _V[1424]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[5][4]);
-  _V[1425]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[5][3]);
-  _V[1426]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[5][2]);
-  _V[1427]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[5][1]);
-  _V[1428]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[4][4]);
-  _V[1429]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[4][3]);
-  _V[1430]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[4][2]);
-  _V[1431]->Fill(RefMult, _q[3][1]*_q[3][3]*_q[4][1]);
-  _V[1432]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[6][6]);
-  _V[1433]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[6][5]);
-  _V[1434]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[6][4]);
-  _V[1435]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[6][3]);
-  _V[1436]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[6][2]);
-  _V[1437]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[6][1]);
-  _V[1438]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[5][5]);
-  _V[1439]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[5][4]);
-  _V[1440]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[5][3]);
-  _V[1441]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[5][2]);
-  _V[1442]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[5][1]);
-  _V[1443]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[4][4]);
-  _V[1444]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[4][3]);
-  _V[1445]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[4][2]);
-  _V[1446]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[4][1]);
-  _V[1447]->Fill(RefMult, _q[3][1]*_q[3][2]*_q[3][3]);
-  _V[1448]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[6][6]);
-  _V[1449]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[6][5]);
-  _V[1450]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[6][4]);
-  _V[1451]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[6][3]);
-  _V[1452]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[6][2]);
-  _V[1453]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[6][1]);
-  _V[1454]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[5][5]);
-  _V[1455]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[5][4]);
-  _V[1456]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[5][3]);
-  _V[1457]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[5][2]);
-  _V[1458]->Fill(RefMult, _q[2][2]*_q[4][4]*_q[5][1]);
-  _V[1459]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[6][6]);
-  _V[1460]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[6][5]);
-  _V[1461]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[6][4]);
-  _V[1462]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[6][3]);
-  _V[1463]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[6][2]);
-  _V[1464]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[6][1]);
-  _V[1465]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[5][5]);
-  _V[1466]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[5][4]);
-  _V[1467]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[5][3]);
-  _V[1468]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[5][2]);
-  _V[1469]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[5][1]);
-  _V[1470]->Fill(RefMult, _q[2][2]*_q[4][3]*_q[4][4]);
-  _V[1471]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[6][6]);
-  _V[1472]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[6][5]);
-  _V[1473]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[6][4]);
-  _V[1474]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[6][3]);
-  _V[1475]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[6][2]);
-  _V[1476]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[6][1]);
-  _V[1477]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[5][5]);
-  _V[1478]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[5][4]);
-  _V[1479]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[5][3]);
-  _V[1480]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[5][2]);
-  _V[1481]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[5][1]);
-  _V[1482]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[4][4]);
-  _V[1483]->Fill(RefMult, _q[2][2]*_q[4][2]*_q[4][3]);
-  _V[1484]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[6][6]);
-  _V[1485]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[6][5]);
-  _V[1486]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[6][4]);
-  _V[1487]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[6][3]);
-  _V[1488]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[6][2]);
-  _V[1489]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[6][1]);
-  _V[1490]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[5][5]);
-  _V[1491]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[5][4]);
-  _V[1492]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[5][3]);
-  _V[1493]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[5][2]);
-  _V[1494]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[5][1]);
-  _V[1495]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[4][4]);
-  _V[1496]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[4][3]);
-  _V[1497]->Fill(RefMult, _q[2][2]*_q[4][1]*_q[4][2]);
-  _V[1498]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[6][6]);
-  _V[1499]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[6][5]);
-  _V[1500]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[6][4]);
-  _V[1501]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[6][3]);
-  _V[1502]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[6][2]);
-  _V[1503]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[6][1]);
-  _V[1504]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[5][5]);
-  _V[1505]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[5][4]);
-  _V[1506]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[5][3]);
-  _V[1507]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[5][2]);
-  _V[1508]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[5][1]);
-  _V[1509]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[4][4]);
-  _V[1510]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[4][3]);
-  _V[1511]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[4][2]);
-  _V[1512]->Fill(RefMult, _q[2][2]*_q[3][3]*_q[4][1]);
-  _V[1513]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[6][6]);
-  _V[1514]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[6][5]);
-  _V[1515]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[6][4]);
-  _V[1516]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[6][3]);
-  _V[1517]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[6][2]);
-  _V[1518]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[6][1]);
-  _V[1519]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[5][5]);
-  _V[1520]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[5][4]);
-  _V[1521]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[5][3]);
-  _V[1522]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[5][2]);
-  _V[1523]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[5][1]);
-  _V[1524]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[4][4]);
-  _V[1525]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[4][3]);
-  _V[1526]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[4][2]);
-  _V[1527]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[4][1]);
-  _V[1528]->Fill(RefMult, _q[2][2]*_q[3][2]*_q[3][3]);
-  _V[1529]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[6][6]);
-  _V[1530]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[6][5]);
-  _V[1531]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[6][4]);
-  _V[1532]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[6][3]);
-  _V[1533]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[6][2]);
-  _V[1534]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[6][1]);
-  _V[1535]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[5][5]);
-  _V[1536]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[5][4]);
-  _V[1537]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[5][3]);
-  _V[1538]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[5][2]);
-  _V[1539]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[5][1]);
-  _V[1540]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[4][4]);
-  _V[1541]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[4][3]);
-  _V[1542]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[4][2]);
-  _V[1543]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[4][1]);
-  _V[1544]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][3]);
-  _V[1545]->Fill(RefMult, _q[2][2]*_q[3][1]*_q[3][2]);
-  _V[1546]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[6][6]);
-  _V[1547]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[6][5]);
-  _V[1548]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[6][4]);
-  _V[1549]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[6][3]);
-  _V[1550]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[6][2]);
-  _V[1551]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[6][1]);
-  _V[1552]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[5][5]);
-  _V[1553]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[5][4]);
-  _V[1554]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[5][3]);
-  _V[1555]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[5][2]);
-  _V[1556]->Fill(RefMult, _q[2][1]*_q[4][4]*_q[5][1]);
-  _V[1557]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[6][6]);
-  _V[1558]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[6][5]);
-  _V[1559]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[6][4]);
-  _V[1560]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[6][3]);
-  _V[1561]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[6][2]);
-  _V[1562]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[6][1]);
-  _V[1563]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[5][5]);
-  _V[1564]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[5][4]);
-  _V[1565]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[5][3]);
-  _V[1566]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[5][2]);
-  _V[1567]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[5][1]);
-  _V[1568]->Fill(RefMult, _q[2][1]*_q[4][3]*_q[4][4]);
-  _V[1569]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[6][6]);
-  _V[1570]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[6][5]);
-  _V[1571]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[6][4]);
-  _V[1572]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[6][3]);
-  _V[1573]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[6][2]);
-  _V[1574]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[6][1]);
-  _V[1575]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[5][5]);
-  _V[1576]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[5][4]);
-  _V[1577]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[5][3]);
-  _V[1578]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[5][2]);
-  _V[1579]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[5][1]);
-  _V[1580]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[4][4]);
-  _V[1581]->Fill(RefMult, _q[2][1]*_q[4][2]*_q[4][3]);
-  _V[1582]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[6][6]);
-  _V[1583]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[6][5]);
-  _V[1584]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[6][4]);
-  _V[1585]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[6][3]);
-  _V[1586]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[6][2]);
-  _V[1587]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[6][1]);
-  _V[1588]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[5][5]);
-  _V[1589]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[5][4]);
-  _V[1590]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[5][3]);
-  _V[1591]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[5][2]);
-  _V[1592]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[5][1]);
-  _V[1593]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[4][4]);
-  _V[1594]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[4][3]);
-  _V[1595]->Fill(RefMult, _q[2][1]*_q[4][1]*_q[4][2]);
-  _V[1596]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[6][6]);
-  _V[1597]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[6][5]);
-  _V[1598]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[6][4]);
-  _V[1599]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[6][3]);
-  _V[1600]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[6][2]);
-  _V[1601]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[6][1]);
-  _V[1602]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[5][5]);
-  _V[1603]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[5][4]);
-  _V[1604]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[5][3]);
-  _V[1605]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[5][2]);
-  _V[1606]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[5][1]);
-  _V[1607]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[4][4]);
-  _V[1608]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[4][3]);
-  _V[1609]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[4][2]);
-  _V[1610]->Fill(RefMult, _q[2][1]*_q[3][3]*_q[4][1]);
-  _V[1611]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[6][6]);
-  _V[1612]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[6][5]);
-  _V[1613]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[6][4]);
-  _V[1614]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[6][3]);
-  _V[1615]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[6][2]);
-  _V[1616]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[6][1]);
-  _V[1617]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[5][5]);
-  _V[1618]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[5][4]);
-  _V[1619]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[5][3]);
-  _V[1620]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[5][2]);
-  _V[1621]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[5][1]);
-  _V[1622]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[4][4]);
-  _V[1623]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[4][3]);
-  _V[1624]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[4][2]);
-  _V[1625]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[4][1]);
-  _V[1626]->Fill(RefMult, _q[2][1]*_q[3][2]*_q[3][3]);
-  _V[1627]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[6][6]);
-  _V[1628]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[6][5]);
-  _V[1629]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[6][4]);
-  _V[1630]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[6][3]);
-  _V[1631]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[6][2]);
-  _V[1632]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[6][1]);
-  _V[1633]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[5][5]);
-  _V[1634]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[5][4]);
-  _V[1635]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[5][3]);
-  _V[1636]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[5][2]);
-  _V[1637]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[5][1]);
-  _V[1638]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[4][4]);
-  _V[1639]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[4][3]);
-  _V[1640]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[4][2]);
-  _V[1641]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[4][1]);
-  _V[1642]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][3]);
-  _V[1643]->Fill(RefMult, _q[2][1]*_q[3][1]*_q[3][2]);
-  _V[1644]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[6][6]);
-  _V[1645]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[6][5]);
-  _V[1646]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[6][4]);
-  _V[1647]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[6][3]);
-  _V[1648]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[6][2]);
-  _V[1649]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[6][1]);
-  _V[1650]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[5][5]);
-  _V[1651]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[5][4]);
-  _V[1652]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[5][3]);
-  _V[1653]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[5][2]);
-  _V[1654]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[5][1]);
-  _V[1655]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][4]);
-  _V[1656]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][3]);
-  _V[1657]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][2]);
-  _V[1658]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[4][1]);
-  _V[1659]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][3]);
-  _V[1660]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][2]);
-  _V[1661]->Fill(RefMult, _q[2][1]*_q[2][2]*_q[3][1]);
-  _V[1662]->Fill(RefMult, _q[1][1]*_q[5][5]*_q[6][6]);
-  _V[1663]->Fill(RefMult, _q[1][1]*_q[5][5]*_q[6][5]);
-  _V[1664]->Fill(RefMult, _q[1][1]*_q[5][5]*_q[6][4]);
-  _V[1665]->Fill(RefMult, _q[1][1]*_q[5][5]*_q[6][3]);
-  _V[1666]->Fill(RefMult, _q[1][1]*_q[5][5]*_q[6][2]);
-  _V[1667]->Fill(RefMult, _q[1][1]*_q[5][5]*_q[6][1]);
-  _V[1668]->Fill(RefMult, _q[1][1]*_q[5][4]*_q[6][6]);
-  _V[1669]->Fill(RefMult, _q[1][1]*_q[5][4]*_q[6][5]);
-  _V[1670]->Fill(RefMult, _q[1][1]*_q[5][4]*_q[6][4]);
-  _V[1671]->Fill(RefMult, _q[1][1]*_q[5][4]*_q[6][3]);
-  _V[1672]->Fill(RefMult, _q[1][1]*_q[5][4]*_q[6][2]);
-  _V[1673]->Fill(RefMult, _q[1][1]*_q[5][4]*_q[6][1]);
-  _V[1674]->Fill(RefMult, _q[1][1]*_q[5][4]*_q[5][5]);
-  _V[1675]->Fill(RefMult, _q[1][1]*_q[5][3]*_q[6][6]);
-  _V[1676]->Fill(RefMult, _q[1][1]*_q[5][3]*_q[6][5]);
-  _V[1677]->Fill(RefMult, _q[1][1]*_q[5][3]*_q[6][4]);
-  _V[1678]->Fill(RefMult, _q[1][1]*_q[5][3]*_q[6][3]);
-  _V[1679]->Fill(RefMult, _q[1][1]*_q[5][3]*_q[6][2]);
-  _V[1680]->Fill(RefMult, _q[1][1]*_q[5][3]*_q[6][1]);
-  _V[1681]->Fill(RefMult, _q[1][1]*_q[5][3]*_q[5][5]);
-  _V[1682]->Fill(RefMult, _q[1][1]*_q[5][3]*_q[5][4]);
-  _V[1683]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[6][6]);
-  _V[1684]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[6][5]);
-  _V[1685]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[6][4]);
-  _V[1686]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[6][3]);
-  _V[1687]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[6][2]);
-  _V[1688]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[6][1]);
-  _V[1689]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[5][5]);
-  _V[1690]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[5][4]);
-  _V[1691]->Fill(RefMult, _q[1][1]*_q[5][2]*_q[5][3]);
-  _V[1692]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[6][6]);
-  _V[1693]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[6][5]);
-  _V[1694]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[6][4]);
-  _V[1695]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[6][3]);
-  _V[1696]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[6][2]);
-  _V[1697]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[6][1]);
-  _V[1698]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[5][5]);
-  _V[1699]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[5][4]);
-  _V[1700]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[5][3]);
-  _V[1701]->Fill(RefMult, _q[1][1]*_q[5][1]*_q[5][2]);
-  _V[1702]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[6][6]);
-  _V[1703]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[6][5]);
-  _V[1704]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[6][4]);
-  _V[1705]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[6][3]);
-  _V[1706]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[6][2]);
-  _V[1707]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[6][1]);
-  _V[1708]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[5][5]);
-  _V[1709]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[5][4]);
-  _V[1710]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[5][3]);
-  _V[1711]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[5][2]);
-  _V[1712]->Fill(RefMult, _q[1][1]*_q[4][4]*_q[5][1]);
-  _V[1713]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[6][6]);
-  _V[1714]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[6][5]);
-  _V[1715]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[6][4]);
-  _V[1716]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[6][3]);
-  _V[1717]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[6][2]);
-  _V[1718]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[6][1]);
-  _V[1719]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[5][5]);
-  _V[1720]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[5][4]);
-  _V[1721]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[5][3]);
-  _V[1722]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[5][2]);
-  _V[1723]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[5][1]);
-  _V[1724]->Fill(RefMult, _q[1][1]*_q[4][3]*_q[4][4]);
-  _V[1725]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[6][6]);
-  _V[1726]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[6][5]);
-  _V[1727]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[6][4]);
-  _V[1728]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[6][3]);
-  _V[1729]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[6][2]);
-  _V[1730]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[6][1]);
-  _V[1731]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[5][5]);
-  _V[1732]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[5][4]);
-  _V[1733]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[5][3]);
-  _V[1734]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[5][2]);
-  _V[1735]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[5][1]);
-  _V[1736]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[4][4]);
-  _V[1737]->Fill(RefMult, _q[1][1]*_q[4][2]*_q[4][3]);
-  _V[1738]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[6][6]);
-  _V[1739]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[6][5]);
-  _V[1740]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[6][4]);
-  _V[1741]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[6][3]);
-  _V[1742]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[6][2]);
-  _V[1743]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[6][1]);
-  _V[1744]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[5][5]);
-  _V[1745]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[5][4]);
-  _V[1746]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[5][3]);
-  _V[1747]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[5][2]);
-  _V[1748]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[5][1]);
-  _V[1749]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[4][4]);
-  _V[1750]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[4][3]);
-  _V[1751]->Fill(RefMult, _q[1][1]*_q[4][1]*_q[4][2]);
-  _V[1752]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[6][6]);
-  _V[1753]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[6][5]);
-  _V[1754]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[6][4]);
-  _V[1755]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[6][3]);
-  _V[1756]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[6][2]);
-  _V[1757]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[6][1]);
-  _V[1758]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[5][5]);
-  _V[1759]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[5][4]);
-  _V[1760]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[5][3]);
-  _V[1761]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[5][2]);
-  _V[1762]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[5][1]);
-  _V[1763]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[4][4]);
-  _V[1764]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[4][3]);
-  _V[1765]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[4][2]);
-  _V[1766]->Fill(RefMult, _q[1][1]*_q[3][3]*_q[4][1]);
-  _V[1767]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[6][6]);
-  _V[1768]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[6][5]);
-  _V[1769]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[6][4]);
-  _V[1770]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[6][3]);
-  _V[1771]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[6][2]);
-  _V[1772]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[6][1]);
-  _V[1773]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[5][5]);
-  _V[1774]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[5][4]);
-  _V[1775]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[5][3]);
-  _V[1776]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[5][2]);
-  _V[1777]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[5][1]);
-  _V[1778]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[4][4]);
-  _V[1779]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[4][3]);
-  _V[1780]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[4][2]);
-  _V[1781]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[4][1]);
-  _V[1782]->Fill(RefMult, _q[1][1]*_q[3][2]*_q[3][3]);
-  _V[1783]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[6][6]);
-  _V[1784]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[6][5]);
-  _V[1785]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[6][4]);
-  _V[1786]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[6][3]);
-  _V[1787]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[6][2]);
-  _V[1788]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[6][1]);
-  _V[1789]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[5][5]);
-  _V[1790]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[5][4]);
-  _V[1791]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[5][3]);
-  _V[1792]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[5][2]);
-  _V[1793]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[5][1]);
-  _V[1794]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[4][4]);
-  _V[1795]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[4][3]);
-  _V[1796]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[4][2]);
-  _V[1797]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[4][1]);
-  _V[1798]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][3]);
-  _V[1799]->Fill(RefMult, _q[1][1]*_q[3][1]*_q[3][2]);
-  _V[1800]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[6][6]);
-  _V[1801]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[6][5]);
-  _V[1802]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[6][4]);
-  _V[1803]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[6][3]);
-  _V[1804]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[6][2]);
-  _V[1805]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[6][1]);
-  _V[1806]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[5][5]);
-  _V[1807]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[5][4]);
-  _V[1808]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[5][3]);
-  _V[1809]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[5][2]);
-  _V[1810]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[5][1]);
-  _V[1811]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][4]);
-  _V[1812]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][3]);
-  _V[1813]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][2]);
-  _V[1814]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[4][1]);
-  _V[1815]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][3]);
-  _V[1816]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][2]);
-  _V[1817]->Fill(RefMult, _q[1][1]*_q[2][2]*_q[3][1]);
-  _V[1818]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[6][6]);
-  _V[1819]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[6][5]);
-  _V[1820]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[6][4]);
-  _V[1821]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[6][3]);
-  _V[1822]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[6][2]);
-  _V[1823]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[6][1]);
-  _V[1824]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[5][5]);
-  _V[1825]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[5][4]);
-  _V[1826]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[5][3]);
-  _V[1827]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[5][2]);
-  _V[1828]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[5][1]);
-  _V[1829]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][4]);
-  _V[1830]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][3]);
-  _V[1831]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][2]);
-  _V[1832]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[4][1]);
-  _V[1833]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][3]);
-  _V[1834]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][2]);
-  _V[1835]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[3][1]);
-  _V[1836]->Fill(RefMult, _q[1][1]*_q[2][1]*_q[2][2]);
-  _V[1837]->Fill(RefMult, pow(_q[3][2],2)*pow(_q[3][3],2));
-  _V[1838]->Fill(RefMult, pow(_q[3][1],2)*pow(_q[3][3],2));
-  _V[1839]->Fill(RefMult, pow(_q[3][1],2)*pow(_q[3][2],2));
-  _V[1840]->Fill(RefMult, pow(_q[2][2],3)*pow(_q[3][3],2));
-  _V[1841]->Fill(RefMult, pow(_q[2][2],3)*pow(_q[3][2],2));
-  _V[1842]->Fill(RefMult, pow(_q[2][2],3)*pow(_q[3][1],2));
-  _V[1843]->Fill(RefMult, pow(_q[2][2],2)*pow(_q[4][4],2));
-  _V[1844]->Fill(RefMult, pow(_q[2][2],2)*pow(_q[4][3],2));
-  _V[1845]->Fill(RefMult, pow(_q[2][2],2)*pow(_q[4][2],2));
-  _V[1846]->Fill(RefMult, pow(_q[2][2],2)*pow(_q[4][1],2));
-  _V[1847]->Fill(RefMult, pow(_q[2][2],2)*pow(_q[3][3],2));
-  _V[1848]->Fill(RefMult, pow(_q[2][2],2)*pow(_q[3][2],2));
-  _V[1849]->Fill(RefMult, pow(_q[2][2],2)*pow(_q[3][1],2));
-  _V[1850]->Fill(RefMult, pow(_q[2][1],4)*pow(_q[2][2],2));
-  _V[1851]->Fill(RefMult, pow(_q[2][1],3)*pow(_q[3][3],2));
-  _V[1852]->Fill(RefMult, pow(_q[2][1],3)*pow(_q[3][2],2));
-  _V[1853]->Fill(RefMult, pow(_q[2][1],3)*pow(_q[3][1],2));
-  _V[1854]->Fill(RefMult, pow(_q[2][1],3)*pow(_q[2][2],3));
-  _V[1855]->Fill(RefMult, pow(_q[2][1],3)*pow(_q[2][2],2));
-  _V[1856]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[4][4],2));
-  _V[1857]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[4][3],2));
-  _V[1858]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[4][2],2));
-  _V[1859]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[4][1],2));
-  _V[1860]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[3][3],2));
-  _V[1861]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[3][2],2));
-  _V[1862]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[3][1],2));
-  _V[1863]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],4));
-  _V[1864]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],3));
-  _V[1865]->Fill(RefMult, pow(_q[2][1],2)*pow(_q[2][2],2));
-  _V[1866]->Fill(RefMult, pow(_q[1][1],8)*pow(_q[2][2],2));
-  _V[1867]->Fill(RefMult, pow(_q[1][1],8)*pow(_q[2][1],2));
-  _V[1868]->Fill(RefMult, pow(_q[1][1],7)*pow(_q[2][2],2));
-  _V[1869]->Fill(RefMult, pow(_q[1][1],7)*pow(_q[2][1],2));
-  _V[1870]->Fill(RefMult, pow(_q[1][1],6)*pow(_q[3][3],2));
-  _V[1871]->Fill(RefMult, pow(_q[1][1],6)*pow(_q[3][2],2));
-  _V[1872]->Fill(RefMult, pow(_q[1][1],6)*pow(_q[3][1],2));
-  _V[1873]->Fill(RefMult, pow(_q[1][1],6)*pow(_q[2][2],3));
-  _V[1874]->Fill(RefMult, pow(_q[1][1],6)*pow(_q[2][2],2));
-  _V[1875]->Fill(RefMult, pow(_q[1][1],6)*pow(_q[2][1],3));
-  _V[1876]->Fill(RefMult, pow(_q[1][1],6)*pow(_q[2][1],2));
-  _V[1877]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[3][3],2));
-  _V[1878]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[3][2],2));
-  _V[1879]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[3][1],2));
-  _V[1880]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][2],3));
-  _V[1881]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][2],2));
-  _V[1882]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][1],3));
-  _V[1883]->Fill(RefMult, pow(_q[1][1],5)*pow(_q[2][1],2));
-  _V[1884]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[4][4],2));
-  _V[1885]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[4][3],2));
-  _V[1886]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[4][2],2));
-  _V[1887]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[4][1],2));
-  _V[1888]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[3][3],2));
-  _V[1889]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[3][2],2));
-  _V[1890]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[3][1],2));
-  _V[1891]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],4));
-  _V[1892]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],3));
-  _V[1893]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][2],2));
-  _V[1894]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],4));
-  _V[1895]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],3));
-  _V[1896]->Fill(RefMult, pow(_q[1][1],4)*pow(_q[2][1],2));
-  _V[1897]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[4][4],2));
-  _V[1898]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[4][3],2));
-  _V[1899]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[4][2],2));
-  _V[1900]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[4][1],2));
-  _V[1901]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][3],3));
-  _V[1902]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][3],2));
-  _V[1903]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][2],3));
-  _V[1904]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][2],2));
-  _V[1905]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][1],3));
-  _V[1906]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[3][1],2));
-  _V[1907]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],4));
-  _V[1908]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],3));
-  _V[1909]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][2],2));
-  _V[1910]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],4));
-  _V[1911]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],3));
-  _V[1912]->Fill(RefMult, pow(_q[1][1],3)*pow(_q[2][1],2));
-  _V[1913]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[5][5],2));
-  _V[1914]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[5][4],2));
-  _V[1915]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[5][3],2));
-  _V[1916]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[5][2],2));
-  _V[1917]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[5][1],2));
-  _V[1918]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[4][4],2));
-  _V[1919]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[4][3],2));
-  _V[1920]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[4][2],2));
-  _V[1921]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[4][1],2));
-  _V[1922]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][3],3));
-  _V[1923]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][3],2));
-  _V[1924]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][2],3));
-  _V[1925]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][2],2));
-  _V[1926]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][1],3));
-  _V[1927]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[3][1],2));
-  _V[1928]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],5));
-  _V[1929]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],4));
-  _V[1930]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],3));
-  _V[1931]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][2],2));
-  _V[1932]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],5));
-  _V[1933]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],4));
-  _V[1934]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],3));
-  _V[1935]->Fill(RefMult, pow(_q[1][1],2)*pow(_q[2][1],2));
-  _V[1936]->Fill(RefMult, pow(_q[1][1],10)*_q[2][2]);
-  _V[1937]->Fill(RefMult, pow(_q[1][1],10)*_q[2][1]);
-  _V[1938]->Fill(RefMult, pow(_q[3][3],2)*_q[6][6]);
-  _V[1939]->Fill(RefMult, pow(_q[3][3],2)*_q[6][5]);
-  _V[1940]->Fill(RefMult, pow(_q[3][3],2)*_q[6][4]);
-  _V[1941]->Fill(RefMult, pow(_q[3][3],2)*_q[6][3]);
-  _V[1942]->Fill(RefMult, pow(_q[3][3],2)*_q[6][2]);
-  _V[1943]->Fill(RefMult, pow(_q[3][3],2)*_q[6][1]);
-  _V[1944]->Fill(RefMult, pow(_q[3][3],2)*_q[5][5]);
-  _V[1945]->Fill(RefMult, pow(_q[3][3],2)*_q[5][4]);
-  _V[1946]->Fill(RefMult, pow(_q[3][3],2)*_q[5][3]);
-  _V[1947]->Fill(RefMult, pow(_q[3][3],2)*_q[5][2]);
-  _V[1948]->Fill(RefMult, pow(_q[3][3],2)*_q[5][1]);
-  _V[1949]->Fill(RefMult, pow(_q[3][3],2)*_q[4][4]);
-  _V[1950]->Fill(RefMult, pow(_q[3][3],2)*_q[4][3]);
-  _V[1951]->Fill(RefMult, pow(_q[3][3],2)*_q[4][2]);
-  _V[1952]->Fill(RefMult, pow(_q[3][3],2)*_q[4][1]);
-  _V[1953]->Fill(RefMult, _q[3][2]*pow(_q[3][3],3));
-  _V[1954]->Fill(RefMult, _q[3][2]*pow(_q[3][3],2));
-  _V[1955]->Fill(RefMult, pow(_q[3][2],3)*_q[3][3]);
-  _V[1956]->Fill(RefMult, pow(_q[3][2],2)*_q[6][6]);
-  _V[1957]->Fill(RefMult, pow(_q[3][2],2)*_q[6][5]);
-  _V[1958]->Fill(RefMult, pow(_q[3][2],2)*_q[6][4]);
-  _V[1959]->Fill(RefMult, pow(_q[3][2],2)*_q[6][3]);
-  _V[1960]->Fill(RefMult, pow(_q[3][2],2)*_q[6][2]);
-  _V[1961]->Fill(RefMult, pow(_q[3][2],2)*_q[6][1]);
-  _V[1962]->Fill(RefMult, pow(_q[3][2],2)*_q[5][5]);
-  _V[1963]->Fill(RefMult, pow(_q[3][2],2)*_q[5][4]);
-  _V[1964]->Fill(RefMult, pow(_q[3][2],2)*_q[5][3]);
-  _V[1965]->Fill(RefMult, pow(_q[3][2],2)*_q[5][2]);
-  _V[1966]->Fill(RefMult, pow(_q[3][2],2)*_q[5][1]);
-  _V[1967]->Fill(RefMult, pow(_q[3][2],2)*_q[4][4]);
-  _V[1968]->Fill(RefMult, pow(_q[3][2],2)*_q[4][3]);
-  _V[1969]->Fill(RefMult, pow(_q[3][2],2)*_q[4][2]);
-  _V[1970]->Fill(RefMult, pow(_q[3][2],2)*_q[4][1]);
-  _V[1971]->Fill(RefMult, pow(_q[3][2],2)*_q[3][3]);
-  _V[1972]->Fill(RefMult, _q[3][1]*pow(_q[3][3],3));
-  _V[1973]->Fill(RefMult, _q[3][1]*pow(_q[3][3],2));
-  _V[1974]->Fill(RefMult, _q[3][1]*pow(_q[3][2],3));
-  _V[1975]->Fill(RefMult, _q[3][1]*pow(_q[3][2],2));
-  _V[1976]->Fill(RefMult, pow(_q[3][1],3)*_q[3][3]);
-  _V[1977]->Fill(RefMult, pow(_q[3][1],3)*_q[3][2]);
-  _V[1978]->Fill(RefMult, pow(_q[3][1],2)*_q[6][6]);
-  _V[1979]->Fill(RefMult, pow(_q[3][1],2)*_q[6][5]);
-  _V[1980]->Fill(RefMult, pow(_q[3][1],2)*_q[6][4]);
-  _V[1981]->Fill(RefMult, pow(_q[3][1],2)*_q[6][3]);
-  _V[1982]->Fill(RefMult, pow(_q[3][1],2)*_q[6][2]);
-  _V[1983]->Fill(RefMult, pow(_q[3][1],2)*_q[6][1]);
-  _V[1984]->Fill(RefMult, pow(_q[3][1],2)*_q[5][5]);
-  _V[1985]->Fill(RefMult, pow(_q[3][1],2)*_q[5][4]);
-  _V[1986]->Fill(RefMult, pow(_q[3][1],2)*_q[5][3]);
-  _V[1987]->Fill(RefMult, pow(_q[3][1],2)*_q[5][2]);
-  _V[1988]->Fill(RefMult, pow(_q[3][1],2)*_q[5][1]);
-  _V[1989]->Fill(RefMult, pow(_q[3][1],2)*_q[4][4]);
-  _V[1990]->Fill(RefMult, pow(_q[3][1],2)*_q[4][3]);
-  _V[1991]->Fill(RefMult, pow(_q[3][1],2)*_q[4][2]);
-  _V[1992]->Fill(RefMult, pow(_q[3][1],2)*_q[4][1]);
-  _V[1993]->Fill(RefMult, pow(_q[3][1],2)*_q[3][3]);
-  _V[1994]->Fill(RefMult, pow(_q[3][1],2)*_q[3][2]);
-  _V[1995]->Fill(RefMult, _q[2][2]*pow(_q[4][4],2));
-  _V[1996]->Fill(RefMult, _q[2][2]*pow(_q[4][3],2));
-  _V[1997]->Fill(RefMult, _q[2][2]*pow(_q[4][2],2));
-  _V[1998]->Fill(RefMult, _q[2][2]*pow(_q[4][1],2));
-  _V[1999]->Fill(RefMult, _q[2][2]*pow(_q[3][3],3));
-  _V[2000]->Fill(RefMult, _q[2][2]*pow(_q[3][3],2));
-  _V[2001]->Fill(RefMult, _q[2][2]*pow(_q[3][2],3));
-  _V[2002]->Fill(RefMult, _q[2][2]*pow(_q[3][2],2));
-  _V[2003]->Fill(RefMult, _q[2][2]*pow(_q[3][1],3));
-  _V[2004]->Fill(RefMult, _q[2][2]*pow(_q[3][1],2));
-  _V[2005]->Fill(RefMult, pow(_q[2][2],4)*_q[4][4]);
-  _V[2006]->Fill(RefMult, pow(_q[2][2],4)*_q[4][3]);
-  _V[2007]->Fill(RefMult, pow(_q[2][2],4)*_q[4][2]);
-  _V[2008]->Fill(RefMult, pow(_q[2][2],4)*_q[4][1]);
-  _V[2009]->Fill(RefMult, pow(_q[2][2],4)*_q[3][3]);
-  _V[2010]->Fill(RefMult, pow(_q[2][2],4)*_q[3][2]);
-  _V[2011]->Fill(RefMult, pow(_q[2][2],4)*_q[3][1]);
-  _V[2012]->Fill(RefMult, pow(_q[2][2],3)*_q[6][6]);
-  _V[2013]->Fill(RefMult, pow(_q[2][2],3)*_q[6][5]);
-  _V[2014]->Fill(RefMult, pow(_q[2][2],3)*_q[6][4]);
-  _V[2015]->Fill(RefMult, pow(_q[2][2],3)*_q[6][3]);
-  _V[2016]->Fill(RefMult, pow(_q[2][2],3)*_q[6][2]);
-  _V[2017]->Fill(RefMult, pow(_q[2][2],3)*_q[6][1]);
-  _V[2018]->Fill(RefMult, pow(_q[2][2],3)*_q[5][5]);
-  _V[2019]->Fill(RefMult, pow(_q[2][2],3)*_q[5][4]);
-  _V[2020]->Fill(RefMult, pow(_q[2][2],3)*_q[5][3]);
-  _V[2021]->Fill(RefMult, pow(_q[2][2],3)*_q[5][2]);
-  _V[2022]->Fill(RefMult, pow(_q[2][2],3)*_q[5][1]);
-  _V[2023]->Fill(RefMult, pow(_q[2][2],3)*_q[4][4]);
-  _V[2024]->Fill(RefMult, pow(_q[2][2],3)*_q[4][3]);
-  _V[2025]->Fill(RefMult, pow(_q[2][2],3)*_q[4][2]);
-  _V[2026]->Fill(RefMult, pow(_q[2][2],3)*_q[4][1]);
-  _V[2027]->Fill(RefMult, pow(_q[2][2],3)*_q[3][3]);
-  _V[2028]->Fill(RefMult, pow(_q[2][2],3)*_q[3][2]);
-  _V[2029]->Fill(RefMult, pow(_q[2][2],3)*_q[3][1]);
-  _V[2030]->Fill(RefMult, pow(_q[2][2],2)*_q[6][6]);
-  _V[2031]->Fill(RefMult, pow(_q[2][2],2)*_q[6][5]);
-  _V[2032]->Fill(RefMult, pow(_q[2][2],2)*_q[6][4]);
-  _V[2033]->Fill(RefMult, pow(_q[2][2],2)*_q[6][3]);
-  _V[2034]->Fill(RefMult, pow(_q[2][2],2)*_q[6][2]);
-  _V[2035]->Fill(RefMult, pow(_q[2][2],2)*_q[6][1]);
-  _V[2036]->Fill(RefMult, pow(_q[2][2],2)*_q[5][5]);
-  _V[2037]->Fill(RefMult, pow(_q[2][2],2)*_q[5][4]);
-  _V[2038]->Fill(RefMult, pow(_q[2][2],2)*_q[5][3]);
-  _V[2039]->Fill(RefMult, pow(_q[2][2],2)*_q[5][2]);
-  _V[2040]->Fill(RefMult, pow(_q[2][2],2)*_q[5][1]);
-  _V[2041]->Fill(RefMult, pow(_q[2][2],2)*_q[4][4]);
-  _V[2042]->Fill(RefMult, pow(_q[2][2],2)*_q[4][3]);
-  _V[2043]->Fill(RefMult, pow(_q[2][2],2)*_q[4][2]);
-  _V[2044]->Fill(RefMult, pow(_q[2][2],2)*_q[4][1]);
-  _V[2045]->Fill(RefMult, pow(_q[2][2],2)*_q[3][3]);
-  _V[2046]->Fill(RefMult, pow(_q[2][2],2)*_q[3][2]);
-  _V[2047]->Fill(RefMult, pow(_q[2][2],2)*_q[3][1]);
-  _V[2048]->Fill(RefMult, _q[2][1]*pow(_q[4][4],2));
-  _V[2049]->Fill(RefMult, _q[2][1]*pow(_q[4][3],2));
-  _V[2050]->Fill(RefMult, _q[2][1]*pow(_q[4][2],2));
-  _V[2051]->Fill(RefMult, _q[2][1]*pow(_q[4][1],2));
-  _V[2052]->Fill(RefMult, _q[2][1]*pow(_q[3][3],3));
-  _V[2053]->Fill(RefMult, _q[2][1]*pow(_q[3][3],2));
-  _V[2054]->Fill(RefMult, _q[2][1]*pow(_q[3][2],3));
-  _V[2055]->Fill(RefMult, _q[2][1]*pow(_q[3][2],2));
-  _V[2056]->Fill(RefMult, _q[2][1]*pow(_q[3][1],3));
-  _V[2057]->Fill(RefMult, _q[2][1]*pow(_q[3][1],2));
-  _V[2058]->Fill(RefMult, _q[2][1]*pow(_q[2][2],5));
-  _V[2059]->Fill(RefMult, _q[2][1]*pow(_q[2][2],4));
-  _V[2060]->Fill(RefMult, _q[2][1]*pow(_q[2][2],3));
-  _V[2061]->Fill(RefMult, _q[2][1]*pow(_q[2][2],2));
-  _V[2062]->Fill(RefMult, pow(_q[2][1],5)*_q[2][2]);
-  _V[2063]->Fill(RefMult, pow(_q[2][1],4)*_q[4][4]);
-  _V[2064]->Fill(RefMult, pow(_q[2][1],4)*_q[4][3]);
-  _V[2065]->Fill(RefMult, pow(_q[2][1],4)*_q[4][2]);
-  _V[2066]->Fill(RefMult, pow(_q[2][1],4)*_q[4][1]);
-  _V[2067]->Fill(RefMult, pow(_q[2][1],4)*_q[3][3]);
-  _V[2068]->Fill(RefMult, pow(_q[2][1],4)*_q[3][2]);
-  _V[2069]->Fill(RefMult, pow(_q[2][1],4)*_q[3][1]);
-  _V[2070]->Fill(RefMult, pow(_q[2][1],4)*_q[2][2]);
-  _V[2071]->Fill(RefMult, pow(_q[2][1],3)*_q[6][6]);
-  _V[2072]->Fill(RefMult, pow(_q[2][1],3)*_q[6][5]);
-  _V[2073]->Fill(RefMult, pow(_q[2][1],3)*_q[6][4]);
-  _V[2074]->Fill(RefMult, pow(_q[2][1],3)*_q[6][3]);
-  _V[2075]->Fill(RefMult, pow(_q[2][1],3)*_q[6][2]);
-  _V[2076]->Fill(RefMult, pow(_q[2][1],3)*_q[6][1]);
-  _V[2077]->Fill(RefMult, pow(_q[2][1],3)*_q[5][5]);
-  _V[2078]->Fill(RefMult, pow(_q[2][1],3)*_q[5][4]);
-  _V[2079]->Fill(RefMult, pow(_q[2][1],3)*_q[5][3]);
-  _V[2080]->Fill(RefMult, pow(_q[2][1],3)*_q[5][2]);
-  _V[2081]->Fill(RefMult, pow(_q[2][1],3)*_q[5][1]);
-  _V[2082]->Fill(RefMult, pow(_q[2][1],3)*_q[4][4]);
-  _V[2083]->Fill(RefMult, pow(_q[2][1],3)*_q[4][3]);
-  _V[2084]->Fill(RefMult, pow(_q[2][1],3)*_q[4][2]);
-  _V[2085]->Fill(RefMult, pow(_q[2][1],3)*_q[4][1]);
-  _V[2086]->Fill(RefMult, pow(_q[2][1],3)*_q[3][3]);
-  _V[2087]->Fill(RefMult, pow(_q[2][1],3)*_q[3][2]);
-  _V[2088]->Fill(RefMult, pow(_q[2][1],3)*_q[3][1]);
-  _V[2089]->Fill(RefMult, pow(_q[2][1],3)*_q[2][2]);
-  _V[2090]->Fill(RefMult, pow(_q[2][1],2)*_q[6][6]);
-  _V[2091]->Fill(RefMult, pow(_q[2][1],2)*_q[6][5]);
-  _V[2092]->Fill(RefMult, pow(_q[2][1],2)*_q[6][4]);
-  _V[2093]->Fill(RefMult, pow(_q[2][1],2)*_q[6][3]);
-  _V[2094]->Fill(RefMult, pow(_q[2][1],2)*_q[6][2]);
-  _V[2095]->Fill(RefMult, pow(_q[2][1],2)*_q[6][1]);
-  _V[2096]->Fill(RefMult, pow(_q[2][1],2)*_q[5][5]);
-  _V[2097]->Fill(RefMult, pow(_q[2][1],2)*_q[5][4]);
-  _V[2098]->Fill(RefMult, pow(_q[2][1],2)*_q[5][3]);
-  _V[2099]->Fill(RefMult, pow(_q[2][1],2)*_q[5][2]);
-  _V[2100]->Fill(RefMult, pow(_q[2][1],2)*_q[5][1]);
-  _V[2101]->Fill(RefMult, pow(_q[2][1],2)*_q[4][4]);
-  _V[2102]->Fill(RefMult, pow(_q[2][1],2)*_q[4][3]);
-  _V[2103]->Fill(RefMult, pow(_q[2][1],2)*_q[4][2]);
-  _V[2104]->Fill(RefMult, pow(_q[2][1],2)*_q[4][1]);
-  _V[2105]->Fill(RefMult, pow(_q[2][1],2)*_q[3][3]);
-  _V[2106]->Fill(RefMult, pow(_q[2][1],2)*_q[3][2]);
-  _V[2107]->Fill(RefMult, pow(_q[2][1],2)*_q[3][1]);
-  _V[2108]->Fill(RefMult, pow(_q[2][1],2)*_q[2][2]);
-  _V[2109]->Fill(RefMult, _q[1][1]*pow(_q[5][5],2));
-  _V[2110]->Fill(RefMult, _q[1][1]*pow(_q[5][4],2));
-  _V[2111]->Fill(RefMult, _q[1][1]*pow(_q[5][3],2));
-  _V[2112]->Fill(RefMult, _q[1][1]*pow(_q[5][2],2));
-  _V[2113]->Fill(RefMult, _q[1][1]*pow(_q[5][1],2));
-  _V[2114]->Fill(RefMult, _q[1][1]*pow(_q[4][4],2));
-  _V[2115]->Fill(RefMult, _q[1][1]*pow(_q[4][3],2));
-  _V[2116]->Fill(RefMult, _q[1][1]*pow(_q[4][2],2));
-  _V[2117]->Fill(RefMult, _q[1][1]*pow(_q[4][1],2));
-  _V[2118]->Fill(RefMult, _q[1][1]*pow(_q[3][3],3));
-  _V[2119]->Fill(RefMult, _q[1][1]*pow(_q[3][3],2));
-  _V[2120]->Fill(RefMult, _q[1][1]*pow(_q[3][2],3));
-  _V[2121]->Fill(RefMult, _q[1][1]*pow(_q[3][2],2));
-  _V[2122]->Fill(RefMult, _q[1][1]*pow(_q[3][1],3));
-  _V[2123]->Fill(RefMult, _q[1][1]*pow(_q[3][1],2));
-  _V[2124]->Fill(RefMult, _q[1][1]*pow(_q[2][2],5));
-  _V[2125]->Fill(RefMult, _q[1][1]*pow(_q[2][2],4));
-  _V[2126]->Fill(RefMult, _q[1][1]*pow(_q[2][2],3));
-  _V[2127]->Fill(RefMult, _q[1][1]*pow(_q[2][2],2));
-  _V[2128]->Fill(RefMult, _q[1][1]*pow(_q[2][1],5));
-  _V[2129]->Fill(RefMult, _q[1][1]*pow(_q[2][1],4));
-  _V[2130]->Fill(RefMult, _q[1][1]*pow(_q[2][1],3));
-  _V[2131]->Fill(RefMult, _q[1][1]*pow(_q[2][1],2));
-  _V[2132]->Fill(RefMult, pow(_q[1][1],9)*_q[3][3]);
-  _V[2133]->Fill(RefMult, pow(_q[1][1],9)*_q[3][2]);
-  _V[2134]->Fill(RefMult, pow(_q[1][1],9)*_q[3][1]);
-  _V[2135]->Fill(RefMult, pow(_q[1][1],9)*_q[2][2]);
-  _V[2136]->Fill(RefMult, pow(_q[1][1],9)*_q[2][1]);
-  _V[2137]->Fill(RefMult, pow(_q[1][1],8)*_q[4][4]);
-  _V[2138]->Fill(RefMult, pow(_q[1][1],8)*_q[4][3]);
-  _V[2139]->Fill(RefMult, pow(_q[1][1],8)*_q[4][2]);
-  _V[2140]->Fill(RefMult, pow(_q[1][1],8)*_q[4][1]);
-  _V[2141]->Fill(RefMult, pow(_q[1][1],8)*_q[3][3]);
-  _V[2142]->Fill(RefMult, pow(_q[1][1],8)*_q[3][2]);
-  _V[2143]->Fill(RefMult, pow(_q[1][1],8)*_q[3][1]);
-  _V[2144]->Fill(RefMult, pow(_q[1][1],8)*_q[2][2]);
-  _V[2145]->Fill(RefMult, pow(_q[1][1],8)*_q[2][1]);
-  _V[2146]->Fill(RefMult, pow(_q[1][1],7)*_q[5][5]);
-  _V[2147]->Fill(RefMult, pow(_q[1][1],7)*_q[5][4]);
-  _V[2148]->Fill(RefMult, pow(_q[1][1],7)*_q[5][3]);
-  _V[2149]->Fill(RefMult, pow(_q[1][1],7)*_q[5][2]);
-  _V[2150]->Fill(RefMult, pow(_q[1][1],7)*_q[5][1]);
-  _V[2151]->Fill(RefMult, pow(_q[1][1],7)*_q[4][4]);
-  _V[2152]->Fill(RefMult, pow(_q[1][1],7)*_q[4][3]);
-  _V[2153]->Fill(RefMult, pow(_q[1][1],7)*_q[4][2]);
-  _V[2154]->Fill(RefMult, pow(_q[1][1],7)*_q[4][1]);
-  _V[2155]->Fill(RefMult, pow(_q[1][1],7)*_q[3][3]);
-  _V[2156]->Fill(RefMult, pow(_q[1][1],7)*_q[3][2]);
-  _V[2157]->Fill(RefMult, pow(_q[1][1],7)*_q[3][1]);
-  _V[2158]->Fill(RefMult, pow(_q[1][1],7)*_q[2][2]);
-  _V[2159]->Fill(RefMult, pow(_q[1][1],7)*_q[2][1]);
-  _V[2160]->Fill(RefMult, pow(_q[1][1],6)*_q[6][6]);
-  _V[2161]->Fill(RefMult, pow(_q[1][1],6)*_q[6][5]);
-  _V[2162]->Fill(RefMult, pow(_q[1][1],6)*_q[6][4]);
-  _V[2163]->Fill(RefMult, pow(_q[1][1],6)*_q[6][3]);
-  _V[2164]->Fill(RefMult, pow(_q[1][1],6)*_q[6][2]);
-  _V[2165]->Fill(RefMult, pow(_q[1][1],6)*_q[6][1]);
-  _V[2166]->Fill(RefMult, pow(_q[1][1],6)*_q[5][5]);
-  _V[2167]->Fill(RefMult, pow(_q[1][1],6)*_q[5][4]);
-  _V[2168]->Fill(RefMult, pow(_q[1][1],6)*_q[5][3]);
-  _V[2169]->Fill(RefMult, pow(_q[1][1],6)*_q[5][2]);
-  _V[2170]->Fill(RefMult, pow(_q[1][1],6)*_q[5][1]);
-  _V[2171]->Fill(RefMult, pow(_q[1][1],6)*_q[4][4]);
-  _V[2172]->Fill(RefMult, pow(_q[1][1],6)*_q[4][3]);
-  _V[2173]->Fill(RefMult, pow(_q[1][1],6)*_q[4][2]);
-  _V[2174]->Fill(RefMult, pow(_q[1][1],6)*_q[4][1]);
-  _V[2175]->Fill(RefMult, pow(_q[1][1],6)*_q[3][3]);
-  _V[2176]->Fill(RefMult, pow(_q[1][1],6)*_q[3][2]);
-  _V[2177]->Fill(RefMult, pow(_q[1][1],6)*_q[3][1]);
-  _V[2178]->Fill(RefMult, pow(_q[1][1],6)*_q[2][2]);
-  _V[2179]->Fill(RefMult, pow(_q[1][1],6)*_q[2][1]);
-  _V[2180]->Fill(RefMult, pow(_q[1][1],5)*_q[6][6]);
-  _V[2181]->Fill(RefMult, pow(_q[1][1],5)*_q[6][5]);
-  _V[2182]->Fill(RefMult, pow(_q[1][1],5)*_q[6][4]);
-  _V[2183]->Fill(RefMult, pow(_q[1][1],5)*_q[6][3]);
-  _V[2184]->Fill(RefMult, pow(_q[1][1],5)*_q[6][2]);
-  _V[2185]->Fill(RefMult, pow(_q[1][1],5)*_q[6][1]);
-  _V[2186]->Fill(RefMult, pow(_q[1][1],5)*_q[5][5]);
-  _V[2187]->Fill(RefMult, pow(_q[1][1],5)*_q[5][4]);
-  _V[2188]->Fill(RefMult, pow(_q[1][1],5)*_q[5][3]);
-  _V[2189]->Fill(RefMult, pow(_q[1][1],5)*_q[5][2]);
-  _V[2190]->Fill(RefMult, pow(_q[1][1],5)*_q[5][1]);
-  _V[2191]->Fill(RefMult, pow(_q[1][1],5)*_q[4][4]);
-  _V[2192]->Fill(RefMult, pow(_q[1][1],5)*_q[4][3]);
-  _V[2193]->Fill(RefMult, pow(_q[1][1],5)*_q[4][2]);
-  _V[2194]->Fill(RefMult, pow(_q[1][1],5)*_q[4][1]);
-  _V[2195]->Fill(RefMult, pow(_q[1][1],5)*_q[3][3]);
-  _V[2196]->Fill(RefMult, pow(_q[1][1],5)*_q[3][2]);
-  _V[2197]->Fill(RefMult, pow(_q[1][1],5)*_q[3][1]);
-  _V[2198]->Fill(RefMult, pow(_q[1][1],5)*_q[2][2]);
-  _V[2199]->Fill(RefMult, pow(_q[1][1],5)*_q[2][1]);
-  _V[2200]->Fill(RefMult, pow(_q[1][1],4)*_q[6][6]);
-  _V[2201]->Fill(RefMult, pow(_q[1][1],4)*_q[6][5]);
-  _V[2202]->Fill(RefMult, pow(_q[1][1],4)*_q[6][4]);
-  _V[2203]->Fill(RefMult, pow(_q[1][1],4)*_q[6][3]);
-  _V[2204]->Fill(RefMult, pow(_q[1][1],4)*_q[6][2]);
-  _V[2205]->Fill(RefMult, pow(_q[1][1],4)*_q[6][1]);
-  _V[2206]->Fill(RefMult, pow(_q[1][1],4)*_q[5][5]);
-  _V[2207]->Fill(RefMult, pow(_q[1][1],4)*_q[5][4]);
-  _V[2208]->Fill(RefMult, pow(_q[1][1],4)*_q[5][3]);
-  _V[2209]->Fill(RefMult, pow(_q[1][1],4)*_q[5][2]);
-  _V[2210]->Fill(RefMult, pow(_q[1][1],4)*_q[5][1]);
-  _V[2211]->Fill(RefMult, pow(_q[1][1],4)*_q[4][4]);
-  _V[2212]->Fill(RefMult, pow(_q[1][1],4)*_q[4][3]);
-  _V[2213]->Fill(RefMult, pow(_q[1][1],4)*_q[4][2]);
-  _V[2214]->Fill(RefMult, pow(_q[1][1],4)*_q[4][1]);
-  _V[2215]->Fill(RefMult, pow(_q[1][1],4)*_q[3][3]);
-  _V[2216]->Fill(RefMult, pow(_q[1][1],4)*_q[3][2]);
-  _V[2217]->Fill(RefMult, pow(_q[1][1],4)*_q[3][1]);
-  _V[2218]->Fill(RefMult, pow(_q[1][1],4)*_q[2][2]);
-  _V[2219]->Fill(RefMult, pow(_q[1][1],4)*_q[2][1]);
-  _V[2220]->Fill(RefMult, pow(_q[1][1],3)*_q[6][6]);
-  _V[2221]->Fill(RefMult, pow(_q[1][1],3)*_q[6][5]);
-  _V[2222]->Fill(RefMult, pow(_q[1][1],3)*_q[6][4]);
-  _V[2223]->Fill(RefMult, pow(_q[1][1],3)*_q[6][3]);
-  _V[2224]->Fill(RefMult, pow(_q[1][1],3)*_q[6][2]);
-  _V[2225]->Fill(RefMult, pow(_q[1][1],3)*_q[6][1]);
-  _V[2226]->Fill(RefMult, pow(_q[1][1],3)*_q[5][5]);
-  _V[2227]->Fill(RefMult, pow(_q[1][1],3)*_q[5][4]);
-  _V[2228]->Fill(RefMult, pow(_q[1][1],3)*_q[5][3]);
-  _V[2229]->Fill(RefMult, pow(_q[1][1],3)*_q[5][2]);
-  _V[2230]->Fill(RefMult, pow(_q[1][1],3)*_q[5][1]);
-  _V[2231]->Fill(RefMult, pow(_q[1][1],3)*_q[4][4]);
-  _V[2232]->Fill(RefMult, pow(_q[1][1],3)*_q[4][3]);
-  _V[2233]->Fill(RefMult, pow(_q[1][1],3)*_q[4][2]);
-  _V[2234]->Fill(RefMult, pow(_q[1][1],3)*_q[4][1]);
-  _V[2235]->Fill(RefMult, pow(_q[1][1],3)*_q[3][3]);
-  _V[2236]->Fill(RefMult, pow(_q[1][1],3)*_q[3][2]);
-  _V[2237]->Fill(RefMult, pow(_q[1][1],3)*_q[3][1]);
-  _V[2238]->Fill(RefMult, pow(_q[1][1],3)*_q[2][2]);
-  _V[2239]->Fill(RefMult, pow(_q[1][1],3)*_q[2][1]);
-  _V[2240]->Fill(RefMult, pow(_q[1][1],2)*_q[6][6]);
-  _V[2241]->Fill(RefMult, pow(_q[1][1],2)*_q[6][5]);
-  _V[2242]->Fill(RefMult, pow(_q[1][1],2)*_q[6][4]);
-  _V[2243]->Fill(RefMult, pow(_q[1][1],2)*_q[6][3]);
-  _V[2244]->Fill(RefMult, pow(_q[1][1],2)*_q[6][2]);
-  _V[2245]->Fill(RefMult, pow(_q[1][1],2)*_q[6][1]);
-  _V[2246]->Fill(RefMult, pow(_q[1][1],2)*_q[5][5]);
-  _V[2247]->Fill(RefMult, pow(_q[1][1],2)*_q[5][4]);
-  _V[2248]->Fill(RefMult, pow(_q[1][1],2)*_q[5][3]);
-  _V[2249]->Fill(RefMult, pow(_q[1][1],2)*_q[5][2]);
-  _V[2250]->Fill(RefMult, pow(_q[1][1],2)*_q[5][1]);
-  _V[2251]->Fill(RefMult, pow(_q[1][1],2)*_q[4][4]);
-  _V[2252]->Fill(RefMult, pow(_q[1][1],2)*_q[4][3]);
-  _V[2253]->Fill(RefMult, pow(_q[1][1],2)*_q[4][2]);
-  _V[2254]->Fill(RefMult, pow(_q[1][1],2)*_q[4][1]);
-  _V[2255]->Fill(RefMult, pow(_q[1][1],2)*_q[3][3]);
-  _V[2256]->Fill(RefMult, pow(_q[1][1],2)*_q[3][2]);
-  _V[2257]->Fill(RefMult, pow(_q[1][1],2)*_q[3][1]);
-  _V[2258]->Fill(RefMult, pow(_q[1][1],2)*_q[2][2]);
-  _V[2259]->Fill(RefMult, pow(_q[1][1],2)*_q[2][1]);
-  _V[2260]->Fill(RefMult, _q[6][5]*_q[6][6]);
-  _V[2261]->Fill(RefMult, _q[6][4]*_q[6][6]);
-  _V[2262]->Fill(RefMult, _q[6][4]*_q[6][5]);
-  _V[2263]->Fill(RefMult, _q[6][3]*_q[6][6]);
-  _V[2264]->Fill(RefMult, _q[6][3]*_q[6][5]);
-  _V[2265]->Fill(RefMult, _q[6][3]*_q[6][4]);
-  _V[2266]->Fill(RefMult, _q[6][2]*_q[6][6]);
-  _V[2267]->Fill(RefMult, _q[6][2]*_q[6][5]);
-  _V[2268]->Fill(RefMult, _q[6][2]*_q[6][4]);
-  _V[2269]->Fill(RefMult, _q[6][2]*_q[6][3]);
-  _V[2270]->Fill(RefMult, _q[6][1]*_q[6][6]);
-  _V[2271]->Fill(RefMult, _q[6][1]*_q[6][5]);
-  _V[2272]->Fill(RefMult, _q[6][1]*_q[6][4]);
-  _V[2273]->Fill(RefMult, _q[6][1]*_q[6][3]);
-  _V[2274]->Fill(RefMult, _q[6][1]*_q[6][2]);
-  _V[2275]->Fill(RefMult, _q[5][5]*_q[6][6]);
-  _V[2276]->Fill(RefMult, _q[5][5]*_q[6][5]);
-  _V[2277]->Fill(RefMult, _q[5][5]*_q[6][4]);
-  _V[2278]->Fill(RefMult, _q[5][5]*_q[6][3]);
-  _V[2279]->Fill(RefMult, _q[5][5]*_q[6][2]);
-  _V[2280]->Fill(RefMult, _q[5][5]*_q[6][1]);
-  _V[2281]->Fill(RefMult, _q[5][4]*_q[6][6]);
-  _V[2282]->Fill(RefMult, _q[5][4]*_q[6][5]);
-  _V[2283]->Fill(RefMult, _q[5][4]*_q[6][4]);
-  _V[2284]->Fill(RefMult, _q[5][4]*_q[6][3]);
-  _V[2285]->Fill(RefMult, _q[5][4]*_q[6][2]);
-  _V[2286]->Fill(RefMult, _q[5][4]*_q[6][1]);
-  _V[2287]->Fill(RefMult, _q[5][4]*_q[5][5]);
-  _V[2288]->Fill(RefMult, _q[5][3]*_q[6][6]);
-  _V[2289]->Fill(RefMult, _q[5][3]*_q[6][5]);
-  _V[2290]->Fill(RefMult, _q[5][3]*_q[6][4]);
-  _V[2291]->Fill(RefMult, _q[5][3]*_q[6][3]);
-  _V[2292]->Fill(RefMult, _q[5][3]*_q[6][2]);
-  _V[2293]->Fill(RefMult, _q[5][3]*_q[6][1]);
-  _V[2294]->Fill(RefMult, _q[5][3]*_q[5][5]);
-  _V[2295]->Fill(RefMult, _q[5][3]*_q[5][4]);
-  _V[2296]->Fill(RefMult, _q[5][2]*_q[6][6]);
-  _V[2297]->Fill(RefMult, _q[5][2]*_q[6][5]);
-  _V[2298]->Fill(RefMult, _q[5][2]*_q[6][4]);
-  _V[2299]->Fill(RefMult, _q[5][2]*_q[6][3]);
-  _V[2300]->Fill(RefMult, _q[5][2]*_q[6][2]);
-  _V[2301]->Fill(RefMult, _q[5][2]*_q[6][1]);
-  _V[2302]->Fill(RefMult, _q[5][2]*_q[5][5]);
-  _V[2303]->Fill(RefMult, _q[5][2]*_q[5][4]);
-  _V[2304]->Fill(RefMult, _q[5][2]*_q[5][3]);
-  _V[2305]->Fill(RefMult, _q[5][1]*_q[6][6]);
-  _V[2306]->Fill(RefMult, _q[5][1]*_q[6][5]);
-  _V[2307]->Fill(RefMult, _q[5][1]*_q[6][4]);
-  _V[2308]->Fill(RefMult, _q[5][1]*_q[6][3]);
-  _V[2309]->Fill(RefMult, _q[5][1]*_q[6][2]);
-  _V[2310]->Fill(RefMult, _q[5][1]*_q[6][1]);
-  _V[2311]->Fill(RefMult, _q[5][1]*_q[5][5]);
-  _V[2312]->Fill(RefMult, _q[5][1]*_q[5][4]);
-  _V[2313]->Fill(RefMult, _q[5][1]*_q[5][3]);
-  _V[2314]->Fill(RefMult, _q[5][1]*_q[5][2]);
-  _V[2315]->Fill(RefMult, _q[4][4]*_q[6][6]);
-  _V[2316]->Fill(RefMult, _q[4][4]*_q[6][5]);
-  _V[2317]->Fill(RefMult, _q[4][4]*_q[6][4]);
-  _V[2318]->Fill(RefMult, _q[4][4]*_q[6][3]);
-  _V[2319]->Fill(RefMult, _q[4][4]*_q[6][2]);
-  _V[2320]->Fill(RefMult, _q[4][4]*_q[6][1]);
-  _V[2321]->Fill(RefMult, _q[4][4]*_q[5][5]);
-  _V[2322]->Fill(RefMult, _q[4][4]*_q[5][4]);
-  _V[2323]->Fill(RefMult, _q[4][4]*_q[5][3]);
-  _V[2324]->Fill(RefMult, _q[4][4]*_q[5][2]);
-  _V[2325]->Fill(RefMult, _q[4][4]*_q[5][1]);
-  _V[2326]->Fill(RefMult, _q[4][3]*_q[6][6]);
-  _V[2327]->Fill(RefMult, _q[4][3]*_q[6][5]);
-  _V[2328]->Fill(RefMult, _q[4][3]*_q[6][4]);
-  _V[2329]->Fill(RefMult, _q[4][3]*_q[6][3]);
-  _V[2330]->Fill(RefMult, _q[4][3]*_q[6][2]);
-  _V[2331]->Fill(RefMult, _q[4][3]*_q[6][1]);
-  _V[2332]->Fill(RefMult, _q[4][3]*_q[5][5]);
-  _V[2333]->Fill(RefMult, _q[4][3]*_q[5][4]);
-  _V[2334]->Fill(RefMult, _q[4][3]*_q[5][3]);
-  _V[2335]->Fill(RefMult, _q[4][3]*_q[5][2]);
-  _V[2336]->Fill(RefMult, _q[4][3]*_q[5][1]);
-  _V[2337]->Fill(RefMult, _q[4][3]*_q[4][4]);
-  _V[2338]->Fill(RefMult, _q[4][2]*_q[6][6]);
-  _V[2339]->Fill(RefMult, _q[4][2]*_q[6][5]);
-  _V[2340]->Fill(RefMult, _q[4][2]*_q[6][4]);
-  _V[2341]->Fill(RefMult, _q[4][2]*_q[6][3]);
-  _V[2342]->Fill(RefMult, _q[4][2]*_q[6][2]);
-  _V[2343]->Fill(RefMult, _q[4][2]*_q[6][1]);
-  _V[2344]->Fill(RefMult, _q[4][2]*_q[5][5]);
-  _V[2345]->Fill(RefMult, _q[4][2]*_q[5][4]);
-  _V[2346]->Fill(RefMult, _q[4][2]*_q[5][3]);
-  _V[2347]->Fill(RefMult, _q[4][2]*_q[5][2]);
-  _V[2348]->Fill(RefMult, _q[4][2]*_q[5][1]);
-  _V[2349]->Fill(RefMult, _q[4][2]*_q[4][4]);
-  _V[2350]->Fill(RefMult, _q[4][2]*_q[4][3]);
-  _V[2351]->Fill(RefMult, _q[4][1]*_q[6][6]);
-  _V[2352]->Fill(RefMult, _q[4][1]*_q[6][5]);
-  _V[2353]->Fill(RefMult, _q[4][1]*_q[6][4]);
-  _V[2354]->Fill(RefMult, _q[4][1]*_q[6][3]);
-  _V[2355]->Fill(RefMult, _q[4][1]*_q[6][2]);
-  _V[2356]->Fill(RefMult, _q[4][1]*_q[6][1]);
-  _V[2357]->Fill(RefMult, _q[4][1]*_q[5][5]);
-  _V[2358]->Fill(RefMult, _q[4][1]*_q[5][4]);
-  _V[2359]->Fill(RefMult, _q[4][1]*_q[5][3]);
-  _V[2360]->Fill(RefMult, _q[4][1]*_q[5][2]);
-  _V[2361]->Fill(RefMult, _q[4][1]*_q[5][1]);
-  _V[2362]->Fill(RefMult, _q[4][1]*_q[4][4]);
-  _V[2363]->Fill(RefMult, _q[4][1]*_q[4][3]);
-  _V[2364]->Fill(RefMult, _q[4][1]*_q[4][2]);
-  _V[2365]->Fill(RefMult, _q[3][3]*_q[6][6]);
-  _V[2366]->Fill(RefMult, _q[3][3]*_q[6][5]);
-  _V[2367]->Fill(RefMult, _q[3][3]*_q[6][4]);
-  _V[2368]->Fill(RefMult, _q[3][3]*_q[6][3]);
-  _V[2369]->Fill(RefMult, _q[3][3]*_q[6][2]);
-  _V[2370]->Fill(RefMult, _q[3][3]*_q[6][1]);
-  _V[2371]->Fill(RefMult, _q[3][3]*_q[5][5]);
-  _V[2372]->Fill(RefMult, _q[3][3]*_q[5][4]);
-  _V[2373]->Fill(RefMult, _q[3][3]*_q[5][3]);
-  _V[2374]->Fill(RefMult, _q[3][3]*_q[5][2]);
-  _V[2375]->Fill(RefMult, _q[3][3]*_q[5][1]);
-  _V[2376]->Fill(RefMult, _q[3][3]*_q[4][4]);
-  _V[2377]->Fill(RefMult, _q[3][3]*_q[4][3]);
-  _V[2378]->Fill(RefMult, _q[3][3]*_q[4][2]);
-  _V[2379]->Fill(RefMult, _q[3][3]*_q[4][1]);
-  _V[2380]->Fill(RefMult, _q[3][2]*_q[6][6]);
-  _V[2381]->Fill(RefMult, _q[3][2]*_q[6][5]);
-  _V[2382]->Fill(RefMult, _q[3][2]*_q[6][4]);
-  _V[2383]->Fill(RefMult, _q[3][2]*_q[6][3]);
-  _V[2384]->Fill(RefMult, _q[3][2]*_q[6][2]);
-  _V[2385]->Fill(RefMult, _q[3][2]*_q[6][1]);
-  _V[2386]->Fill(RefMult, _q[3][2]*_q[5][5]);
-  _V[2387]->Fill(RefMult, _q[3][2]*_q[5][4]);
-  _V[2388]->Fill(RefMult, _q[3][2]*_q[5][3]);
-  _V[2389]->Fill(RefMult, _q[3][2]*_q[5][2]);
-  _V[2390]->Fill(RefMult, _q[3][2]*_q[5][1]);
-  _V[2391]->Fill(RefMult, _q[3][2]*_q[4][4]);
-  _V[2392]->Fill(RefMult, _q[3][2]*_q[4][3]);
-  _V[2393]->Fill(RefMult, _q[3][2]*_q[4][2]);
-  _V[2394]->Fill(RefMult, _q[3][2]*_q[4][1]);
-  _V[2395]->Fill(RefMult, _q[3][2]*_q[3][3]);
-  _V[2396]->Fill(RefMult, _q[3][1]*_q[6][6]);
-  _V[2397]->Fill(RefMult, _q[3][1]*_q[6][5]);
-  _V[2398]->Fill(RefMult, _q[3][1]*_q[6][4]);
-  _V[2399]->Fill(RefMult, _q[3][1]*_q[6][3]);
-  _V[2400]->Fill(RefMult, _q[3][1]*_q[6][2]);
-  _V[2401]->Fill(RefMult, _q[3][1]*_q[6][1]);
-  _V[2402]->Fill(RefMult, _q[3][1]*_q[5][5]);
-  _V[2403]->Fill(RefMult, _q[3][1]*_q[5][4]);
-  _V[2404]->Fill(RefMult, _q[3][1]*_q[5][3]);
-  _V[2405]->Fill(RefMult, _q[3][1]*_q[5][2]);
-  _V[2406]->Fill(RefMult, _q[3][1]*_q[5][1]);
-  _V[2407]->Fill(RefMult, _q[3][1]*_q[4][4]);
-  _V[2408]->Fill(RefMult, _q[3][1]*_q[4][3]);
-  _V[2409]->Fill(RefMult, _q[3][1]*_q[4][2]);
-  _V[2410]->Fill(RefMult, _q[3][1]*_q[4][1]);
-  _V[2411]->Fill(RefMult, _q[3][1]*_q[3][3]);
-  _V[2412]->Fill(RefMult, _q[3][1]*_q[3][2]);
-  _V[2413]->Fill(RefMult, _q[2][2]*_q[6][6]);
-  _V[2414]->Fill(RefMult, _q[2][2]*_q[6][5]);
-  _V[2415]->Fill(RefMult, _q[2][2]*_q[6][4]);
-  _V[2416]->Fill(RefMult, _q[2][2]*_q[6][3]);
-  _V[2417]->Fill(RefMult, _q[2][2]*_q[6][2]);
-  _V[2418]->Fill(RefMult, _q[2][2]*_q[6][1]);
-  _V[2419]->Fill(RefMult, _q[2][2]*_q[5][5]);
-  _V[2420]->Fill(RefMult, _q[2][2]*_q[5][4]);
-  _V[2421]->Fill(RefMult, _q[2][2]*_q[5][3]);
-  _V[2422]->Fill(RefMult, _q[2][2]*_q[5][2]);
-  _V[2423]->Fill(RefMult, _q[2][2]*_q[5][1]);
-  _V[2424]->Fill(RefMult, _q[2][2]*_q[4][4]);
-  _V[2425]->Fill(RefMult, _q[2][2]*_q[4][3]);
-  _V[2426]->Fill(RefMult, _q[2][2]*_q[4][2]);
-  _V[2427]->Fill(RefMult, _q[2][2]*_q[4][1]);
-  _V[2428]->Fill(RefMult, _q[2][2]*_q[3][3]);
-  _V[2429]->Fill(RefMult, _q[2][2]*_q[3][2]);
-  _V[2430]->Fill(RefMult, _q[2][2]*_q[3][1]);
-  _V[2431]->Fill(RefMult, _q[2][1]*_q[6][6]);
-  _V[2432]->Fill(RefMult, _q[2][1]*_q[6][5]);
-  _V[2433]->Fill(RefMult, _q[2][1]*_q[6][4]);
-  _V[2434]->Fill(RefMult, _q[2][1]*_q[6][3]);
-  _V[2435]->Fill(RefMult, _q[2][1]*_q[6][2]);
-  _V[2436]->Fill(RefMult, _q[2][1]*_q[6][1]);
-  _V[2437]->Fill(RefMult, _q[2][1]*_q[5][5]);
-  _V[2438]->Fill(RefMult, _q[2][1]*_q[5][4]);
-  _V[2439]->Fill(RefMult, _q[2][1]*_q[5][3]);
-  _V[2440]->Fill(RefMult, _q[2][1]*_q[5][2]);
-  _V[2441]->Fill(RefMult, _q[2][1]*_q[5][1]);
-  _V[2442]->Fill(RefMult, _q[2][1]*_q[4][4]);
-  _V[2443]->Fill(RefMult, _q[2][1]*_q[4][3]);
-  _V[2444]->Fill(RefMult, _q[2][1]*_q[4][2]);
-  _V[2445]->Fill(RefMult, _q[2][1]*_q[4][1]);
-  _V[2446]->Fill(RefMult, _q[2][1]*_q[3][3]);
-  _V[2447]->Fill(RefMult, _q[2][1]*_q[3][2]);
-  _V[2448]->Fill(RefMult, _q[2][1]*_q[3][1]);
-  _V[2449]->Fill(RefMult, _q[2][1]*_q[2][2]);
-  _V[2450]->Fill(RefMult, _q[1][1]*_q[6][6]);
-  _V[2451]->Fill(RefMult, _q[1][1]*_q[6][5]);
-  _V[2452]->Fill(RefMult, _q[1][1]*_q[6][4]);
-  _V[2453]->Fill(RefMult, _q[1][1]*_q[6][3]);
-  _V[2454]->Fill(RefMult, _q[1][1]*_q[6][2]);
-  _V[2455]->Fill(RefMult, _q[1][1]*_q[6][1]);
-  _V[2456]->Fill(RefMult, _q[1][1]*_q[5][5]);
-  _V[2457]->Fill(RefMult, _q[1][1]*_q[5][4]);
-  _V[2458]->Fill(RefMult, _q[1][1]*_q[5][3]);
-  _V[2459]->Fill(RefMult, _q[1][1]*_q[5][2]);
-  _V[2460]->Fill(RefMult, _q[1][1]*_q[5][1]);
-  _V[2461]->Fill(RefMult, _q[1][1]*_q[4][4]);
-  _V[2462]->Fill(RefMult, _q[1][1]*_q[4][3]);
-  _V[2463]->Fill(RefMult, _q[1][1]*_q[4][2]);
-  _V[2464]->Fill(RefMult, _q[1][1]*_q[4][1]);
-  _V[2465]->Fill(RefMult, _q[1][1]*_q[3][3]);
-  _V[2466]->Fill(RefMult, _q[1][1]*_q[3][2]);
-  _V[2467]->Fill(RefMult, _q[1][1]*_q[3][1]);
-  _V[2468]->Fill(RefMult, _q[1][1]*_q[2][2]);
-  _V[2469]->Fill(RefMult, _q[1][1]*_q[2][1]);
-  _V[2470]->Fill(RefMult, pow(_q[1][1],12));
-  _V[2471]->Fill(RefMult, pow(_q[1][1],11));
-  _V[2472]->Fill(RefMult, pow(_q[1][1],10));
-  _V[2473]->Fill(RefMult, pow(_q[6][6],2));
-  _V[2474]->Fill(RefMult, pow(_q[6][5],2));
-  _V[2475]->Fill(RefMult, pow(_q[6][4],2));
-  _V[2476]->Fill(RefMult, pow(_q[6][3],2));
-  _V[2477]->Fill(RefMult, pow(_q[6][2],2));
-  _V[2478]->Fill(RefMult, pow(_q[6][1],2));
-  _V[2479]->Fill(RefMult, pow(_q[5][5],2));
-  _V[2480]->Fill(RefMult, pow(_q[5][4],2));
-  _V[2481]->Fill(RefMult, pow(_q[5][3],2));
-  _V[2482]->Fill(RefMult, pow(_q[5][2],2));
-  _V[2483]->Fill(RefMult, pow(_q[5][1],2));
-  _V[2484]->Fill(RefMult, pow(_q[4][4],2));
-  _V[2485]->Fill(RefMult, pow(_q[4][3],2));
-  _V[2486]->Fill(RefMult, pow(_q[4][2],2));
-  _V[2487]->Fill(RefMult, pow(_q[4][1],2));
-  _V[2488]->Fill(RefMult, pow(_q[3][3],4));
-  _V[2489]->Fill(RefMult, pow(_q[3][3],3));
-  _V[2490]->Fill(RefMult, pow(_q[3][3],2));
-  _V[2491]->Fill(RefMult, pow(_q[3][2],4));
-  _V[2492]->Fill(RefMult, pow(_q[3][2],3));
-  _V[2493]->Fill(RefMult, pow(_q[3][2],2));
-  _V[2494]->Fill(RefMult, pow(_q[3][1],4));
-  _V[2495]->Fill(RefMult, pow(_q[3][1],3));
-  _V[2496]->Fill(RefMult, pow(_q[3][1],2));
-  _V[2497]->Fill(RefMult, pow(_q[2][2],6));
-  _V[2498]->Fill(RefMult, pow(_q[2][2],5));
-  _V[2499]->Fill(RefMult, pow(_q[2][2],4));
-  _V[2500]->Fill(RefMult, pow(_q[2][2],3));
-  _V[2501]->Fill(RefMult, pow(_q[2][2],2));
-  _V[2502]->Fill(RefMult, pow(_q[2][1],6));
-  _V[2503]->Fill(RefMult, pow(_q[2][1],5));
-  _V[2504]->Fill(RefMult, pow(_q[2][1],4));
-  _V[2505]->Fill(RefMult, pow(_q[2][1],3));
-  _V[2506]->Fill(RefMult, pow(_q[2][1],2));
-  _V[2507]->Fill(RefMult, pow(_q[1][1],9));
-  _V[2508]->Fill(RefMult, pow(_q[1][1],8));
-  _V[2509]->Fill(RefMult, pow(_q[1][1],7));
-  _V[2510]->Fill(RefMult, pow(_q[1][1],6));
-  _V[2511]->Fill(RefMult, pow(_q[1][1],5));
-  _V[2512]->Fill(RefMult, pow(_q[1][1],4));
-  _V[2513]->Fill(RefMult, pow(_q[1][1],3));
-  _V[2514]->Fill(RefMult, pow(_q[1][1],2));
-  _V[2515]->Fill(RefMult, _q[6][6]);
-  _V[2516]->Fill(RefMult, _q[6][5]);
-  _V[2517]->Fill(RefMult, _q[6][4]);
-  _V[2518]->Fill(RefMult, _q[6][3]);
-  _V[2519]->Fill(RefMult, _q[6][2]);
-  _V[2520]->Fill(RefMult, _q[6][1]);
-  _V[2521]->Fill(RefMult, _q[5][5]);
-  _V[2522]->Fill(RefMult, _q[5][4]);
-  _V[2523]->Fill(RefMult, _q[5][3]);
-  _V[2524]->Fill(RefMult, _q[5][2]);
-  _V[2525]->Fill(RefMult, _q[5][1]);
-  _V[2526]->Fill(RefMult, _q[4][4]);
-  _V[2527]->Fill(RefMult, _q[4][3]);
-  _V[2528]->Fill(RefMult, _q[4][2]);
-  _V[2529]->Fill(RefMult, _q[4][1]);
-  _V[2530]->Fill(RefMult, _q[3][3]);
-  _V[2531]->Fill(RefMult, _q[3][2]);
-  _V[2532]->Fill(RefMult, _q[3][1]);
-  _V[2533]->Fill(RefMult, _q[2][2]);
-  _V[2534]->Fill(RefMult, _q[2][1]);
-  _V[2535]->Fill(RefMult, _q[1][1]);
-  //xxxxxxxxxxxxxxxxxxxxxxxxxxx
-  for(int r=1;r<=6; ++r){
-    for(int s=1; s<=6; ++s){
-      _q[r][s] = 0;
+  Store(RefMult, &_q[0], _nTrack);
+  for(size_t i=0; i<_q.size(); ++i){
+    _q[i] = 0;
+  }
+  _nTrack = 0;
+
+}
+
+void Loader::Store(int RefMult, const Double_t* q, int nTracks){
+
+  int bin = FindBin(RefMult);
+  if(bin % _nShards == _iShard){ // otherwise owned by another shard
+    Fill(bin, q, nTracks);
+  }
+  if(_qDump){
+    int head[2] = {RefMult, nTracks};
+    fwrite(head, sizeof(int), 2, _qDump);
+    fwrite(q, sizeof(Double_t), _spec.GetNq(), _qDump);
+  }
+  _inputOffset += 1;
+  if(_ckName.empty()){ return; }
+  bool due = _ckEvents > 0 && _inputOffset - _ckLastOffset >= _ckEvents;
+  if(!due && _ckSeconds > 0){
+    due = std::chrono::duration<double>(std::chrono::steady_clock::now() - _ckLastTime).count() >= _ckSeconds;
+  }
+  if(due && Checkpoint(_ckName.c_str())){
+    _ckLastOffset = _inputOffset;
+    _ckLastTime = std::chrono::steady_clock::now();
+  }
+
+}
+
+void Loader::Fill(int bin, const Double_t* q, int nTracks){
+
+  const int nq = _spec.GetNq();
+  if(nTracks < 0){
+    //unknown, but an event without tracks is still cheap to spot
+    nTracks = 0;
+    for(int i=0; i<nq && nTracks==0; ++i){
+      if(q[i] != 0){ nTracks = -1; }
     }
   }
+  if(nTracks == 0){
+    //every term is zero, only the entries change
+    _entries[bin] += 1;
+    return;
+  }
+  if(nTracks == 1 && nq > 1 && (q[0] == q[1] || q[0] == -q[1])){
+    //one track with weight +-1: q_{r,s} = (+-1)^r u^s, u = q_{2,1} = 1/eff,
+    //keep sum of u^S and of (+-1) u^S, expanded into the terms when written
+    std::vector<Double_t>& sg = _single[bin];
+    if(sg.empty()){
+      sg.assign(2*_nSinglePow, 0);
+    }
+    Double_t sign = q[0] == q[1] ? 1 : -1;
+    Double_t us = 1;
+    for(int S=0; S<_nSinglePow; ++S){
+      sg[2*S] += us;
+      sg[2*S+1] += sign*us;
+      us *= q[1];
+    }
+    _entries[bin] += 1;
+    return;
+  }
+  Push(bin, q);
+  _entries[bin] += 1;
+
+}
+
+void Loader::Push(int bin, const Double_t* q){
+
+  //the event waits for kPending events of its bin, see FlushBin
+  const int nq = _spec.GetNq();
+  std::vector<Double_t>& pq = _pending[bin];
+  if(pq.empty()){
+    pq.assign(nq*kPending, 0);
+  }
+  for(int k=0; k<nq; ++k){
+    pq[k*kPending+_nPending[bin]] = q[k];
+  }
+  _nPending[bin] += 1;
+  if(_nPending[bin] == kPending){
+    FlushBin(bin);
+  }
+
+}
+
+void Loader::FlushBin(int bin){
+
+  //terms of the pending events, kPending at a time: each term is its prefix
+  //term times one q, see TermSpec, unused event slots hold q = 0 and add 0
+  if(_nPending[bin] == 0){ return; }
+  const int nq = _spec.GetNq();
+  Double_t* pq = &_pending[bin][0];
+  Double_t* t = &_tb[0];
+  for(int i=0; i<nq; ++i){
+    const Double_t* qi = pq + _spec.GetFactor(i)*kPending;
+    for(int e=0; e<kPending; ++e){
+      t[i*kPending+e] = qi[e];
+    }
+  }
+  const int* plan = &_plan[0];
+  for(int i=nq; i<_nTerms; ++i, plan+=2){
+    const Double_t* tp = t + plan[0]*kPending;
+    const Double_t* qf = pq + plan[1]*kPending;
+    Double_t* ti = t + i*kPending;
+    for(int e=0; e<kPending; ++e){
+      ti[e] = tp[e] * qf[e];
+    }
+  }
+  //one contiguous row of (sum, sum2) pairs for all of them
+  std::vector<Double_t>& r = _rows[bin];
+  if(r.empty()){
+    r.assign(2*_nTerms, 0);
+  }
+  Double_t* row = &r[0];
+  for(int i=0; i<_nTerms; ++i){
+    const Double_t* ti = t + i*kPending;
+    Double_t sum = 0, sum2 = 0;
+    for(int e=0; e<kPending; ++e){
+      sum += ti[e];
+      sum2 += ti[e]*ti[e];
+    }
+    row[0] += sum;
+    row[1] += sum2;
+    row += 2;
+  }
+  for(int k=0; k<nq*kPending; ++k){
+    pq[k] = 0;
+  }
+  _nPending[bin] = 0;
 
 }
 
+void Loader::Flush(){
 
+  //before the rows are written
+  for(size_t bin=0; bin<_nPending.size(); ++bin){
+    FlushBin(bin);
+  }
 
+}
@@ -1,31 +1,131 @@
 #ifndef LOADER_H
 #define LOADER_H
 
+#include <vector>
+#include <cstdio>
+#include <string>
+#include <set>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include "Rtypes.h"
+#include "TermSpec.h"
+
 class TProfile;
 class TH1D;
 class TFile;
+class TDirectory;
+class TermFile;
 
 //CumLoader saves terms for cumulants calculation only.
 //Loader also saves terms for stat. error calculation.
+//The terms and their names come from TermSpec.
+//For parallel filling, every worker thread fills its own shard made with
+//Loader(proto, iShard, nShards). A shard only keeps events whose RefMult bin
+//satisfies bin % nShards == iShard (see Accepts), so every bin is summed by
+//one shard in input order, and Merge gives the same numbers, bit by bit,
+//for any number of shards.
+
+//q dump written by Loader::SetQDump: QDumpHeader, then for every event
+//int RefMult, int nTracks and Double_t q[nq], packed as in TermSpec::QIndex
+struct QDumpHeader {
+  char magic[8]; // "CUMQDMP1"
+  char type[32];
+  int maxOrder;
+  int nq;
+  static const char* Magic() { return "CUMQDMP1"; }
+};
 
 class Loader {
 
   public:
-    Loader(const char*, int);
+    Loader(const char*, int, int MaxOrder = 6); // MaxOrder 1 .. 8, e.g. 4 for C1 ~ C4 only
+    Loader(const Loader&, int, int); // empty shard iShard of nShards
     ~Loader();
     void ReadTrack(float, float);
+    void ReadTracks(const float*, const float*, int); // all tracks of one event
     void Store(int);
+    void Store(int, const Double_t*, int nTracks = -1); // event with given packed q_{r,s}
     void Save(const char*);
-    void Update(const char*);
+    void Update(const char*); // adds the terms already in the file
+    void SaveBinary(const char*); // binary terms file, see TermFile.h
+    void UpdateBinary(const char*);
+    bool ReadBinary(const char*); // adds the terms of a binary file
+    bool ReadBinary(const TermFile&);
+    bool Add(const char*); // adds the terms of a TProfile or binary file
+    bool Add(TDirectory*); // same for a TProfile file already open, e.g. for all particle types
+    //checkpoints are binary terms files that also keep the input offset,
+    //the number of Store calls unless set with SetInputOffset
+    void SetCheckpoint(const char*, long long nEvents, double seconds = 0); // 0 = never
+    bool Checkpoint(const char*); // false if the previous one is still being written
+    bool IsCheckpointing() const { return _ckBusy; }
+    long long Resume(const char*); // returns the input offset to go on from
+    void SetInputOffset(long long offset) { _inputOffset = offset; } // entry of the next Store
+    long long GetInputOffset() const { return _inputOffset; }
+    void SetQDump(const char*); // 0 closes it
+    long long Replay(const char*, int nThreads = 1); // Stores the events of a q dump
+    const TermSpec& GetSpec() const { return _spec; }
+    bool Accepts(int) const;
+    void Merge(const Loader&); // the input offset becomes the larger of the two
 
   private:
     int _nMultBin;
     const char* ParticleType;
     int LowEventCut;
-    Double_t _q[7][7];
-    static const Int_t _nTerms = 2535;
-    TProfile* _V[_nTerms+1]; // -> _nTerms + 1
-    const Char_t* Terms[_nTerms]={"q01_01_2q02_01q02_02q03_02q03_03","q01_01_2q02_01q02_02q03_01q03_03","q01_01_2q02_01q02_02q03_01q03_02","q01_01q02_02q03_01q03_02q03_03","q01_01q02_01q03_01q03_02q03_03","q01_01q02_01q02_02q03_03q04_04","q01_01q02_01q02_02q03_03q04_03","q01_01q02_01q02_02q03_03q04_02","q01_01q02_01q02_02q03_03q04_01","q01_01q02_01q02_02q03_02q04_04","q01_01q02_01q02_02q03_02q04_03","q01_01q02_01q02_02q03_02q04_02","q01_01q02_01q02_02q03_02q04_01","q01_01q02_01q02_02q03_02q03_03","q01_01q02_01q02_02q03_01q04_04","q01_01q02_01q02_02q03_01q04_03","q01_01q02_01q02_02q03_01q04_02","q01_01q02_01q02_02q03_01q04_01","q01_01q02_01q02_02q03_01q03_03","q01_01q02_01q02_02q03_01q03_02","q01_01q02_01_2q02_02_2q03_03","q01_01q02_01_2q02_02_2q03_02","q01_01q02_01_2q02_02_2q03_01","q01_01_3q02_01q02_02_2q03_03","q01_01_3q02_01q02_02_2q03_02","q01_01_3q02_01q02_02_2q03_01","q01_01_3q02_01_2q02_02q03_03","q01_01_3q02_01_2q02_02q03_02","q01_01_3q02_01_2q02_02q03_01","q01_01_2q02_02_2q03_02q03_03","q01_01_2q02_02_2q03_01q03_03","q01_01_2q02_02_2q03_01q03_02","q01_01_2q02_01q02_02q03_03_2","q01_01_2q02_01q02_02q03_02_2","q01_01_2q02_01q02_02q03_01_2","q01_01_2q02_01q02_02_2q04_04","q01_01_2q02_01q02_02_2q04_03","q01_01_2q02_01q02_02_2q04_02","q01_01_2q02_01q02_02_2q04_01","q01_01_2q02_01q02_02_2q03_03","q01_01_2q02_01q02_02_2q03_02","q01_01_2q02_01q02_02_2q03_01","q01_01_2q02_01_2q03_02q03_03","q01_01_2q02_01_2q03_01q03_03","q01_01_2q02_01_2q03_01q03_02","q01_01_2q02_01_2q02_02q04_04","q01_01_2q02_01_2q02_02q04_03","q01_01_2q02_01_2q02_02q04_02","q01_01_2q02_01_2q02_02q04_01","q01_01_2q02_01_2q02_02q03_03","q01_01_2q02_01_2q02_02q03_02","q01_01_2q02_01_2q02_02q03_01","q02_01q02_02_2q03_02q03_03","q02_01q02_02_2q03_01q03_03","q02_01q02_02_2q03_01q03_02","q02_01_2q02_02q03_02q03_03","q02_01_2q02_02q03_01q03_03","q02_01_2q02_02q03_01q03_02","q01_01q02_02q03_02q03_03_2","q01_01q02_02q03_02_2q03_03","q01_01q02_02q03_01q03_03_2","q01_01q02_02q03_01q03_02_2","q01_01q02_02q03_01_2q03_03","q01_01q02_02q03_01_2q03_02","q01_01q02_02_2q03_03q04_04","q01_01q02_02_2q03_03q04_03","q01_01q02_02_2q03_03q04_02","q01_01q02_02_2q03_03q04_01","q01_01q02_02_2q03_02q04_04","q01_01q02_02_2q03_02q04_03","q01_01q02_02_2q03_02q04_02","q01_01q02_02_2q03_02q04_01","q01_01q02_02_2q03_02q03_03","q01_01q02_02_2q03_01q04_04","q01_01q02_02_2q03_01q04_03","q01_01q02_02_2q03_01q04_02","q01_01q02_02_2q03_01q04_01","q01_01q02_02_2q03_01q03_03","q01_01q02_02_2q03_01q03_02","q01_01q02_01q03_02q03_03_2","q01_01q02_01q03_02_2q03_03","q01_01q02_01q03_01q03_03_2","q01_01q02_01q03_01q03_02_2","q01_01q02_01q03_01_2q03_03","q01_01q02_01q03_01_2q03_02","q01_01q02_01q02_02q03_03_2","q01_01q02_01q02_02q03_02_2","q01_01q02_01q02_02q03_01_2","q01_01q02_01q02_02_3q03_03","q01_01q02_01q02_02_3q03_02","q01_01q02_01q02_02_3q03_01","q01_01q02_01q02_02_2q05_05","q01_01q02_01q02_02_2q05_04","q01_01q02_01q02_02_2q05_03","q01_01q02_01q02_02_2q05_02","q01_01q02_01q02_02_2q05_01","q01_01q02_01q02_02_2q04_04","q01_01q02_01q02_02_2q04_03","q01_01q02_01q02_02_2q04_02","q01_01q02_01q02_02_2q04_01","q01_01q02_01q02_02_2q03_03","q01_01q02_01q02_02_2q03_02","q01_01q02_01q02_02_2q03_01","q01_01q02_01_3q02_02q03_03","q01_01q02_01_3q02_02q03_02","q01_01q02_01_3q02_02q03_01","q01_01q02_01_2q03_03q04_04","q01_01q02_01_2q03_03q04_03","q01_01q02_01_2q03_03q04_02","q01_01q02_01_2q03_03q04_01","q01_01q02_01_2q03_02q04_04","q01_01q02_01_2q03_02q04_03","q01_01q02_01_2q03_02q04_02","q01_01q02_01_2q03_02q04_01","q01_01q02_01_2q03_02q03_03","q01_01q02_01_2q03_01q04_04","q01_01q02_01_2q03_01q04_03","q01_01q02_01_2q03_01q04_02","q01_01q02_01_2q03_01q04_01","q01_01q02_01_2q03_01q03_03","q01_01q02_01_2q03_01q03_02","q01_01q02_01_2q02_02q05_05","q01_01q02_01_2q02_02q05_04","q01_01q02_01_2q02_02q05_03","q01_01q02_01_2q02_02q05_02","q01_01q02_01_2q02_02q05_01","q01_01q02_01_2q02_02q04_04","q01_01q02_01_2q02_02q04_03","q01_01q02_01_2q02_02q04_02","q01_01q02_01_2q02_02q04_01","q01_01q02_01_2q02_02q03_03","q01_01q02_01_2q02_02q03_02","q01_01q02_01_2q02_02q03_01","q01_01_5q02_01q02_02q03_03","q01_01_5q02_01q02_02q03_02","q01_01_5q02_01q02_02q03_01","q01_01_4q02_02q03_02q03_03","q01_01_4q02_02q03_01q03_03","q01_01_4q02_02q03_01q03_02","q01_01_4q02_01q03_02q03_03","q01_01_4q02_01q03_01q03_03","q01_01_4q02_01q03_01q03_02","q01_01_4q02_01q02_02q04_04","q01_01_4q02_01q02_02q04_03","q01_01_4q02_01q02_02q04_02","q01_01_4q02_01q02_02q04_01","q01_01_4q02_01q02_02q03_03","q01_01_4q02_01q02_02q03_02","q01_01_4q02_01q02_02q03_01","q01_01_3q03_01q03_02q03_03","q01_01_3q02_02q03_03q04_04","q01_01_3q02_02q03_03q04_03","q01_01_3q02_02q03_03q04_02","q01_01_3q02_02q03_03q04_01","q01_01_3q02_02q03_02q04_04","q01_01_3q02_02q03_02q04_03","q01_01_3q02_02q03_02q04_02","q01_01_3q02_02q03_02q04_01","q01_01_3q02_02q03_02q03_03","q01_01_3q02_02q03_01q04_04","q01_01_3q02_02q03_01q04_03","q01_01_3q02_02q03_01q04_02","q01_01_3q02_02q03_01q04_01","q01_01_3q02_02q03_01q03_03","q01_01_3q02_02q03_01q03_02","q01_01_3q02_01q03_03q04_04","q01_01_3q02_01q03_03q04_03","q01_01_3q02_01q03_03q04_02","q01_01_3q02_01q03_03q04_01","q01_01_3q02_01q03_02q04_04","q01_01_3q02_01q03_02q04_03","q01_01_3q02_01q03_02q04_02","q01_01_3q02_01q03_02q04_01","q01_01_3q02_01q03_02q03_03","q01_01_3q02_01q03_01q04_04","q01_01_3q02_01q03_01q04_03","q01_01_3q02_01q03_01q04_02","q01_01_3q02_01q03_01q04_01","q01_01_3q02_01q03_01q03_03","q01_01_3q02_01q03_01q03_02","q01_01_3q02_01q02_02q05_05","q01_01_3q02_01q02_02q05_04","q01_01_3q02_01q02_02q05_03","q01_01_3q02_01q02_02q05_02","q01_01_3q02_01q02_02q05_01","q01_01_3q02_01q02_02q04_04","q01_01_3q02_01q02_02q04_03","q01_01_3q02_01q02_02q04_02","q01_01_3q02_01q02_02q04_01","q01_01_3q02_01q02_02q03_03","q01_01_3q02_01q02_02q03_02","q01_01_3q02_01q02_02q03_01","q01_01_2q03_02q03_03q04_04","q01_01_2q03_02q03_03q04_03","q01_01_2q03_02q03_03q04_02","q01_01_2q03_02q03_03q04_01","q01_01_2q03_01q03_03q04_04","q01_01_2q03_01q03_03q04_03","q01_01_2q03_01q03_03q04_02","q01_01_2q03_01q03_03q04_01","q01_01_2q03_01q03_02q04_04","q01_01_2q03_01q03_02q04_03","q01_01_2q03_01q03_02q04_02","q01_01_2q03_01q03_02q04_01","q01_01_2q03_01q03_02q03_03","q01_01_2q02_02q04_03q04_04","q01_01_2q02_02q04_02q04_04","q01_01_2q02_02q04_02q04_03","q01_01_2q02_02q04_01q04_04","q01_01_2q02_02q04_01q04_03","q01_01_2q02_02q04_01q04_02","q01_01_2q02_02q03_03q05_05","q01_01_2q02_02q03_03q05_04","q01_01_2q02_02q03_03q05_03","q01_01_2q02_02q03_03q05_02","q01_01_2q02_02q03_03q05_01","q01_01_2q02_02q03_03q04_04","q01_01_2q02_02q03_03q04_03","q01_01_2q02_02q03_03q04_02","q01_01_2q02_02q03_03q04_01","q01_01_2q02_02q03_02q05_05","q01_01_2q02_02q03_02q05_04","q01_01_2q02_02q03_02q05_03","q01_01_2q02_02q03_02q05_02","q01_01_2q02_02q03_02q05_01","q01_01_2q02_02q03_02q04_04","q01_01_2q02_02q03_02q04_03","q01_01_2q02_02q03_02q04_02","q01_01_2q02_02q03_02q04_01","q01_01_2q02_02q03_02q03_03","q01_01_2q02_02q03_01q05_05","q01_01_2q02_02q03_01q05_04","q01_01_2q02_02q03_01q05_03","q01_01_2q02_02q03_01q05_02","q01_01_2q02_02q03_01q05_01","q01_01_2q02_02q03_01q04_04","q01_01_2q02_02q03_01q04_03","q01_01_2q02_02q03_01q04_02","q01_01_2q02_02q03_01q04_01","q01_01_2q02_02q03_01q03_03","q01_01_2q02_02q03_01q03_02","q01_01_2q02_01q04_03q04_04","q01_01_2q02_01q04_02q04_04","q01_01_2q02_01q04_02q04_03","q01_01_2q02_01q04_01q04_04","q01_01_2q02_01q04_01q04_03","q01_01_2q02_01q04_01q04_02","q01_01_2q02_01q03_03q05_05","q01_01_2q02_01q03_03q05_04","q01_01_2q02_01q03_03q05_03","q01_01_2q02_01q03_03q05_02","q01_01_2q02_01q03_03q05_01","q01_01_2q02_01q03_03q04_04","q01_01_2q02_01q03_03q04_03","q01_01_2q02_01q03_03q04_02","q01_01_2q02_01q03_03q04_01","q01_01_2q02_01q03_02q05_05","q01_01_2q02_01q03_02q05_04","q01_01_2q02_01q03_02q05_03","q01_01_2q02_01q03_02q05_02","q01_01_2q02_01q03_02q05_01","q01_01_2q02_01q03_02q04_04","q01_01_2q02_01q03_02q04_03","q01_01_2q02_01q03_02q04_02","q01_01_2q02_01q03_02q04_01","q01_01_2q02_01q03_02q03_03","q01_01_2q02_01q03_01q05_05","q01_01_2q02_01q03_01q05_04","q01_01_2q02_01q03_01q05_03","q01_01_2q02_01q03_01q05_02","q01_01_2q02_01q03_01q05_01","q01_01_2q02_01q03_01q04_04","q01_01_2q02_01q03_01q04_03","q01_01_2q02_01q03_01q04_02","q01_01_2q02_01q03_01q04_01","q01_01_2q02_01q03_01q03_03","q01_01_2q02_01q03_01q03_02","q01_01_2q02_01q02_02q06_06","q01_01_2q02_01q02_02q06_05","q01_01_2q02_01q02_02q06_04","q01_01_2q02_01q02_02q06_03","q01_01_2q02_01q02_02q06_02","q01_01_2q02_01q02_02q06_01","q01_01_2q02_01q02_02q05_05","q01_01_2q02_01q02_02q05_04","q01_01_2q02_01q02_02q05_03","q01_01_2q02_01q02_02q05_02","q01_01_2q02_01q02_02q05_01","q01_01_2q02_01q02_02q04_04","q01_01_2q02_01q02_02q04_03","q01_01_2q02_01q02_02q04_02","q01_01_2q02_01q02_02q04_01","q01_01_2q02_01q02_02q03_03","q01_01_2q02_01q02_02q03_02","q01_01_2q02_01q02_02q03_01","q02_02q03_02q03_03q04_04","q02_02q03_02q03_03q04_03","q02_02q03_02q03_03q04_02","q02_02q03_02q03_03q04_01","q02_02q03_01q03_03q04_04","q02_02q03_01q03_03q04_03","q02_02q03_01q03_03q04_02","q02_02q03_01q03_03q04_01","q02_02q03_01q03_02q04_04","q02_02q03_01q03_02q04_03","q02_02q03_01q03_02q04_02","q02_02q03_01q03_02q04_01","q02_02q03_01q03_02q03_03","q02_01q03_02q03_03q04_04","q02_01q03_02q03_03q04_03","q02_01q03_02q03_03q04_02","q02_01q03_02q03_03q04_01","q02_01q03_01q03_03q04_04","q02_01q03_01q03_03q04_03","q02_01q03_01q03_03q04_02","q02_01q03_01q03_03q04_01","q02_01q03_01q03_02q04_04","q02_01q03_01q03_02q04_03","q02_01q03_01q03_02q04_02","q02_01q03_01q03_02q04_01","q02_01q03_01q03_02q03_03","q02_01q02_02q04_03q04_04","q02_01q02_02q04_02q04_04","q02_01q02_02q04_02q04_03","q02_01q02_02q04_01q04_04","q02_01q02_02q04_01q04_03","q02_01q02_02q04_01q04_02","q02_01q02_02q03_03q04_04","q02_01q02_02q03_03q04_03","q02_01q02_02q03_03q04_02","q02_01q02_02q03_03q04_01","q02_01q02_02q03_02q04_04","q02_01q02_02q03_02q04_03","q02_01q02_02q03_02q04_02","q02_01q02_02q03_02q04_01","q02_01q02_02q03_02q03_03","q02_01q02_02q03_01q04_04","q02_01q02_02q03_01q04_03","q02_01q02_02q03_01q04_02","q02_01q02_02q03_01q04_01","q02_01q02_02q03_01q03_03","q02_01q02_02q03_01q03_02","q01_01q03_02q03_03q05_05","q01_01q03_02q03_03q05_04","q01_01q03_02q03_03q05_03","q01_01q03_02q03_03q05_02","q01_01q03_02q03_03q05_01","q01_01q03_02q03_03q04_04","q01_01q03_02q03_03q04_03","q01_01q03_02q03_03q04_02","q01_01q03_02q03_03q04_01","q01_01q03_01q03_03q05_05","q01_01q03_01q03_03q05_04","q01_01q03_01q03_03q05_03","q01_01q03_01q03_03q05_02","q01_01q03_01q03_03q05_01","q01_01q03_01q03_03q04_04","q01_01q03_01q03_03q04_03","q01_01q03_01q03_03q04_02","q01_01q03_01q03_03q04_01","q01_01q03_01q03_02q05_05","q01_01q03_01q03_02q05_04","q01_01q03_01q03_02q05_03","q01_01q03_01q03_02q05_02","q01_01q03_01q03_02q05_01","q01_01q03_01q03_02q04_04","q01_01q03_01q03_02q04_03","q01_01q03_01q03_02q04_02","q01_01q03_01q03_02q04_01","q01_01q03_01q03_02q03_03","q01_01q02_02q04_04q05_05","q01_01q02_02q04_04q05_04","q01_01q02_02q04_04q05_03","q01_01q02_02q04_04q05_02","q01_01q02_02q04_04q05_01","q01_01q02_02q04_03q05_05","q01_01q02_02q04_03q05_04","q01_01q02_02q04_03q05_03","q01_01q02_02q04_03q05_02","q01_01q02_02q04_03q05_01","q01_01q02_02q04_03q04_04","q01_01q02_02q04_02q05_05","q01_01q02_02q04_02q05_04","q01_01q02_02q04_02q05_03","q01_01q02_02q04_02q05_02","q01_01q02_02q04_02q05_01","q01_01q02_02q04_02q04_04","q01_01q02_02q04_02q04_03","q01_01q02_02q04_01q05_05","q01_01q02_02q04_01q05_04","q01_01q02_02q04_01q05_03","q01_01q02_02q04_01q05_02","q01_01q02_02q04_01q05_01","q01_01q02_02q04_01q04_04","q01_01q02_02q04_01q04_03","q01_01q02_02q04_01q04_02","q01_01q02_02q03_03q06_06","q01_01q02_02q03_03q06_05","q01_01q02_02q03_03q06_04","q01_01q02_02q03_03q06_03","q01_01q02_02q03_03q06_02","q01_01q02_02q03_03q06_01","q01_01q02_02q03_03q05_05","q01_01q02_02q03_03q05_04","q01_01q02_02q03_03q05_03","q01_01q02_02q03_03q05_02","q01_01q02_02q03_03q05_01","q01_01q02_02q03_03q04_04","q01_01q02_02q03_03q04_03","q01_01q02_02q03_03q04_02","q01_01q02_02q03_03q04_01","q01_01q02_02q03_02q06_06","q01_01q02_02q03_02q06_05","q01_01q02_02q03_02q06_04","q01_01q02_02q03_02q06_03","q01_01q02_02q03_02q06_02","q01_01q02_02q03_02q06_01","q01_01q02_02q03_02q05_05","q01_01q02_02q03_02q05_04","q01_01q02_02q03_02q05_03","q01_01q02_02q03_02q05_02","q01_01q02_02q03_02q05_01","q01_01q02_02q03_02q04_04","q01_01q02_02q03_02q04_03","q01_01q02_02q03_02q04_02","q01_01q02_02q03_02q04_01","q01_01q02_02q03_02q03_03","q01_01q02_02q03_01q06_06","q01_01q02_02q03_01q06_05","q01_01q02_02q03_01q06_04","q01_01q02_02q03_01q06_03","q01_01q02_02q03_01q06_02","q01_01q02_02q03_01q06_01","q01_01q02_02q03_01q05_05","q01_01q02_02q03_01q05_04","q01_01q02_02q03_01q05_03","q01_01q02_02q03_01q05_02","q01_01q02_02q03_01q05_01","q01_01q02_02q03_01q04_04","q01_01q02_02q03_01q04_03","q01_01q02_02q03_01q04_02","q01_01q02_02q03_01q04_01","q01_01q02_02q03_01q03_03","q01_01q02_02q03_01q03_02","q01_01q02_01q04_04q05_05","q01_01q02_01q04_04q05_04","q01_01q02_01q04_04q05_03","q01_01q02_01q04_04q05_02","q01_01q02_01q04_04q05_01","q01_01q02_01q04_03q05_05","q01_01q02_01q04_03q05_04","q01_01q02_01q04_03q05_03","q01_01q02_01q04_03q05_02","q01_01q02_01q04_03q05_01","q01_01q02_01q04_03q04_04","q01_01q02_01q04_02q05_05","q01_01q02_01q04_02q05_04","q01_01q02_01q04_02q05_03","q01_01q02_01q04_02q05_02","q01_01q02_01q04_02q05_01","q01_01q02_01q04_02q04_04","q01_01q02_01q04_02q04_03","q01_01q02_01q04_01q05_05","q01_01q02_01q04_01q05_04","q01_01q02_01q04_01q05_03","q01_01q02_01q04_01q05_02","q01_01q02_01q04_01q05_01","q01_01q02_01q04_01q04_04","q01_01q02_01q04_01q04_03","q01_01q02_01q04_01q04_02","q01_01q02_01q03_03q06_06","q01_01q02_01q03_03q06_05","q01_01q02_01q03_03q06_04","q01_01q02_01q03_03q06_03","q01_01q02_01q03_03q06_02","q01_01q02_01q03_03q06_01","q01_01q02_01q03_03q05_05","q01_01q02_01q03_03q05_04","q01_01q02_01q03_03q05_03","q01_01q02_01q03_03q05_02","q01_01q02_01q03_03q05_01","q01_01q02_01q03_03q04_04","q01_01q02_01q03_03q04_03","q01_01q02_01q03_03q04_02","q01_01q02_01q03_03q04_01","q01_01q02_01q03_02q06_06","q01_01q02_01q03_02q06_05","q01_01q02_01q03_02q06_04","q01_01q02_01q03_02q06_03","q01_01q02_01q03_02q06_02","q01_01q02_01q03_02q06_01","q01_01q02_01q03_02q05_05","q01_01q02_01q03_02q05_04","q01_01q02_01q03_02q05_03","q01_01q02_01q03_02q05_02","q01_01q02_01q03_02q05_01","q01_01q02_01q03_02q04_04","q01_01q02_01q03_02q04_03","q01_01q02_01q03_02q04_02","q01_01q02_01q03_02q04_01","q01_01q02_01q03_02q03_03","q01_01q02_01q03_01q06_06","q01_01q02_01q03_01q06_05","q01_01q02_01q03_01q06_04","q01_01q02_01q03_01q06_03","q01_01q02_01q03_01q06_02","q01_01q02_01q03_01q06_01","q01_01q02_01q03_01q05_05","q01_01q02_01q03_01q05_04","q01_01q02_01q03_01q05_03","q01_01q02_01q03_01q05_02","q01_01q02_01q03_01q05_01","q01_01q02_01q03_01q04_04","q01_01q02_01q03_01q04_03","q01_01q02_01q03_01q04_02","q01_01q02_01q03_01q04_01","q01_01q02_01q03_01q03_03","q01_01q02_01q03_01q03_02","q01_01q02_01q02_02q06_06","q01_01q02_01q02_02q06_05","q01_01q02_01q02_02q06_04","q01_01q02_01q02_02q06_03","q01_01q02_01q02_02q06_02","q01_01q02_01q02_02q06_01","q01_01q02_01q02_02q05_05","q01_01q02_01q02_02q05_04","q01_01q02_01q02_02q05_03","q01_01q02_01q02_02q05_02","q01_01q02_01q02_02q05_01","q01_01q02_01q02_02q04_04","q01_01q02_01q02_02q04_03","q01_01q02_01q02_02q04_02","q01_01q02_01q02_02q04_01","q01_01q02_01q02_02q03_03","q01_01q02_01q02_02q03_02","q01_01q02_01q02_02q03_01","q01_01_4q02_01_2q02_02_2","q01_01_3q02_01_2q02_02_2","q01_01_2q02_02_2q03_03_2","q01_01_2q02_02_2q03_02_2","q01_01_2q02_02_2q03_01_2","q01_01_2q02_01_3q02_02_2","q01_01_2q02_01_2q03_03_2","q01_01_2q02_01_2q03_02_2","q01_01_2q02_01_2q03_01_2","q01_01_2q02_01_2q02_02_3","q01_01_2q02_01_2q02_02_2","q02_01q02_02_2q03_03_2","q02_01q02_02_2q03_02_2","q02_01q02_02_2q03_01_2","q02_01_2q02_02q03_03_2","q02_01_2q02_02q03_02_2","q02_01_2q02_02q03_01_2","q02_01_2q02_02_2q04_04","q02_01_2q02_02_2q04_03","q02_01_2q02_02_2q04_02","q02_01_2q02_02_2q04_01","q02_01_2q02_02_2q03_03","q02_01_2q02_02_2q03_02","q02_01_2q02_02_2q03_01","q01_01q02_02_2q03_03_2","q01_01q02_02_2q03_02_2","q01_01q02_02_2q03_01_2","q01_01q02_01_3q02_02_2","q01_01q02_01_2q03_03_2","q01_01q02_01_2q03_02_2","q01_01q02_01_2q03_01_2","q01_01q02_01_2q02_02_3","q01_01q02_01_2q02_02_2","q01_01_6q02_01q02_02_2","q01_01_6q02_01_2q02_02","q01_01_5q02_02_2q03_03","q01_01_5q02_02_2q03_02","q01_01_5q02_02_2q03_01","q01_01_5q02_01q02_02_2","q01_01_5q02_01_2q03_03","q01_01_5q02_01_2q03_02","q01_01_5q02_01_2q03_01","q01_01_5q02_01_2q02_02","q01_01_4q02_02q03_03_2","q01_01_4q02_02q03_02_2","q01_01_4q02_02q03_01_2","q01_01_4q02_02_2q04_04","q01_01_4q02_02_2q04_03","q01_01_4q02_02_2q04_02","q01_01_4q02_02_2q04_01","q01_01_4q02_02_2q03_03","q01_01_4q02_02_2q03_02","q01_01_4q02_02_2q03_01","q01_01_4q02_01q03_03_2","q01_01_4q02_01q03_02_2","q01_01_4q02_01q03_01_2","q01_01_4q02_01q02_02_3","q01_01_4q02_01q02_02_2","q01_01_4q02_01_3q02_02","q01_01_4q02_01_2q04_04","q01_01_4q02_01_2q04_03","q01_01_4q02_01_2q04_02","q01_01_4q02_01_2q04_01","q01_01_4q02_01_2q03_03","q01_01_4q02_01_2q03_02","q01_01_4q02_01_2q03_01","q01_01_4q02_01_2q02_02","q01_01_3q03_02q03_03_2","q01_01_3q03_02_2q03_03","q01_01_3q03_01q03_03_2","q01_01_3q03_01q03_02_2","q01_01_3q03_01_2q03_03","q01_01_3q03_01_2q03_02","q01_01_3q02_02q03_03_2","q01_01_3q02_02q03_02_2","q01_01_3q02_02q03_01_2","q01_01_3q02_02_3q03_03","q01_01_3q02_02_3q03_02","q01_01_3q02_02_3q03_01","q01_01_3q02_02_2q05_05","q01_01_3q02_02_2q05_04","q01_01_3q02_02_2q05_03","q01_01_3q02_02_2q05_02","q01_01_3q02_02_2q05_01","q01_01_3q02_02_2q04_04","q01_01_3q02_02_2q04_03","q01_01_3q02_02_2q04_02","q01_01_3q02_02_2q04_01","q01_01_3q02_02_2q03_03","q01_01_3q02_02_2q03_02","q01_01_3q02_02_2q03_01","q01_01_3q02_01q03_03_2","q01_01_3q02_01q03_02_2","q01_01_3q02_01q03_01_2","q01_01_3q02_01q02_02_3","q01_01_3q02_01q02_02_2","q01_01_3q02_01_3q03_03","q01_01_3q02_01_3q03_02","q01_01_3q02_01_3q03_01","q01_01_3q02_01_3q02_02","q01_01_3q02_01_2q05_05","q01_01_3q02_01_2q05_04","q01_01_3q02_01_2q05_03","q01_01_3q02_01_2q05_02","q01_01_3q02_01_2q05_01","q01_01_3q02_01_2q04_04","q01_01_3q02_01_2q04_03","q01_01_3q02_01_2q04_02","q01_01_3q02_01_2q04_01","q01_01_3q02_01_2q03_03","q01_01_3q02_01_2q03_02","q01_01_3q02_01_2q03_01","q01_01_3q02_01_2q02_02","q01_01_2q03_03_2q04_04","q01_01_2q03_03_2q04_03","q01_01_2q03_03_2q04_02","q01_01_2q03_03_2q04_01","q01_01_2q03_02q03_03_2","q01_01_2q03_02_2q04_04","q01_01_2q03_02_2q04_03","q01_01_2q03_02_2q04_02","q01_01_2q03_02_2q04_01","q01_01_2q03_02_2q03_03","q01_01_2q03_01q03_03_2","q01_01_2q03_01q03_02_2","q01_01_2q03_01_2q04_04","q01_01_2q03_01_2q04_03","q01_01_2q03_01_2q04_02","q01_01_2q03_01_2q04_01","q01_01_2q03_01_2q03_03","q01_01_2q03_01_2q03_02","q01_01_2q02_02q04_04_2","q01_01_2q02_02q04_03_2","q01_01_2q02_02q04_02_2","q01_01_2q02_02q04_01_2","q01_01_2q02_02q03_03_2","q01_01_2q02_02q03_02_2","q01_01_2q02_02q03_01_2","q01_01_2q02_02_3q04_04","q01_01_2q02_02_3q04_03","q01_01_2q02_02_3q04_02","q01_01_2q02_02_3q04_01","q01_01_2q02_02_3q03_03","q01_01_2q02_02_3q03_02","q01_01_2q02_02_3q03_01","q01_01_2q02_02_2q06_06","q01_01_2q02_02_2q06_05","q01_01_2q02_02_2q06_04","q01_01_2q02_02_2q06_03","q01_01_2q02_02_2q06_02","q01_01_2q02_02_2q06_01","q01_01_2q02_02_2q05_05","q01_01_2q02_02_2q05_04","q01_01_2q02_02_2q05_03","q01_01_2q02_02_2q05_02","q01_01_2q02_02_2q05_01","q01_01_2q02_02_2q04_04","q01_01_2q02_02_2q04_03","q01_01_2q02_02_2q04_02","q01_01_2q02_02_2q04_01","q01_01_2q02_02_2q03_03","q01_01_2q02_02_2q03_02","q01_01_2q02_02_2q03_01","q01_01_2q02_01q04_04_2","q01_01_2q02_01q04_03_2","q01_01_2q02_01q04_02_2","q01_01_2q02_01q04_01_2","q01_01_2q02_01q03_03_2","q01_01_2q02_01q03_02_2","q01_01_2q02_01q03_01_2","q01_01_2q02_01q02_02_4","q01_01_2q02_01q02_02_3","q01_01_2q02_01q02_02_2","q01_01_2q02_01_4q02_02","q01_01_2q02_01_3q04_04","q01_01_2q02_01_3q04_03","q01_01_2q02_01_3q04_02","q01_01_2q02_01_3q04_01","q01_01_2q02_01_3q03_03","q01_01_2q02_01_3q03_02","q01_01_2q02_01_3q03_01","q01_01_2q02_01_3q02_02","q01_01_2q02_01_2q06_06","q01_01_2q02_01_2q06_05","q01_01_2q02_01_2q06_04","q01_01_2q02_01_2q06_03","q01_01_2q02_01_2q06_02","q01_01_2q02_01_2q06_01","q01_01_2q02_01_2q05_05","q01_01_2q02_01_2q05_04","q01_01_2q02_01_2q05_03","q01_01_2q02_01_2q05_02","q01_01_2q02_01_2q05_01","q01_01_2q02_01_2q04_04","q01_01_2q02_01_2q04_03","q01_01_2q02_01_2q04_02","q01_01_2q02_01_2q04_01","q01_01_2q02_01_2q03_03","q01_01_2q02_01_2q03_02","q01_01_2q02_01_2q03_01","q01_01_2q02_01_2q02_02","q03_01q03_02q03_03_2","q03_01q03_02_2q03_03","q03_01_2q03_02q03_03","q02_02q03_03_2q04_04","q02_02q03_03_2q04_03","q02_02q03_03_2q04_02","q02_02q03_03_2q04_01","q02_02q03_02q03_03_2","q02_02q03_02_2q04_04","q02_02q03_02_2q04_03","q02_02q03_02_2q04_02","q02_02q03_02_2q04_01","q02_02q03_02_2q03_03","q02_02q03_01q03_03_2","q02_02q03_01q03_02_2","q02_02q03_01_2q04_04","q02_02q03_01_2q04_03","q02_02q03_01_2q04_02","q02_02q03_01_2q04_01","q02_02q03_01_2q03_03","q02_02q03_01_2q03_02","q02_02_3q03_02q03_03","q02_02_3q03_01q03_03","q02_02_3q03_01q03_02","q02_02_2q04_03q04_04","q02_02_2q04_02q04_04","q02_02_2q04_02q04_03","q02_02_2q04_01q04_04","q02_02_2q04_01q04_03","q02_02_2q04_01q04_02","q02_02_2q03_03q04_04","q02_02_2q03_03q04_03","q02_02_2q03_03q04_02","q02_02_2q03_03q04_01","q02_02_2q03_02q04_04","q02_02_2q03_02q04_03","q02_02_2q03_02q04_02","q02_02_2q03_02q04_01","q02_02_2q03_02q03_03","q02_02_2q03_01q04_04","q02_02_2q03_01q04_03","q02_02_2q03_01q04_02","q02_02_2q03_01q04_01","q02_02_2q03_01q03_03","q02_02_2q03_01q03_02","q02_01q03_03_2q04_04","q02_01q03_03_2q04_03","q02_01q03_03_2q04_02","q02_01q03_03_2q04_01","q02_01q03_02q03_03_2","q02_01q03_02_2q04_04","q02_01q03_02_2q04_03","q02_01q03_02_2q04_02","q02_01q03_02_2q04_01","q02_01q03_02_2q03_03","q02_01q03_01q03_03_2","q02_01q03_01q03_02_2","q02_01q03_01_2q04_04","q02_01q03_01_2q04_03","q02_01q03_01_2q04_02","q02_01q03_01_2q04_01","q02_01q03_01_2q03_03","q02_01q03_01_2q03_02","q02_01q02_02q04_04_2","q02_01q02_02q04_03_2","q02_01q02_02q04_02_2","q02_01q02_02q04_01_2","q02_01q02_02q03_03_2","q02_01q02_02q03_02_2","q02_01q02_02q03_01_2","q02_01q02_02_3q04_04","q02_01q02_02_3q04_03","q02_01q02_02_3q04_02","q02_01q02_02_3q04_01","q02_01q02_02_3q03_03","q02_01q02_02_3q03_02","q02_01q02_02_3q03_01","q02_01q02_02_2q06_06","q02_01q02_02_2q06_05","q02_01q02_02_2q06_04","q02_01q02_02_2q06_03","q02_01q02_02_2q06_02","q02_01q02_02_2q06_01","q02_01q02_02_2q05_05","q02_01q02_02_2q05_04","q02_01q02_02_2q05_03","q02_01q02_02_2q05_02","q02_01q02_02_2q05_01","q02_01q02_02_2q04_04","q02_01q02_02_2q04_03","q02_01q02_02_2q04_02","q02_01q02_02_2q04_01","q02_01q02_02_2q03_03","q02_01q02_02_2q03_02","q02_01q02_02_2q03_01","q02_01_3q03_02q03_03","q02_01_3q03_01q03_03","q02_01_3q03_01q03_02","q02_01_3q02_02q04_04","q02_01_3q02_02q04_03","q02_01_3q02_02q04_02","q02_01_3q02_02q04_01","q02_01_3q02_02q03_03","q02_01_3q02_02q03_02","q02_01_3q02_02q03_01","q02_01_2q04_03q04_04","q02_01_2q04_02q04_04","q02_01_2q04_02q04_03","q02_01_2q04_01q04_04","q02_01_2q04_01q04_03","q02_01_2q04_01q04_02","q02_01_2q03_03q04_04","q02_01_2q03_03q04_03","q02_01_2q03_03q04_02","q02_01_2q03_03q04_01","q02_01_2q03_02q04_04","q02_01_2q03_02q04_03","q02_01_2q03_02q04_02","q02_01_2q03_02q04_01","q02_01_2q03_02q03_03","q02_01_2q03_01q04_04","q02_01_2q03_01q04_03","q02_01_2q03_01q04_02","q02_01_2q03_01q04_01","q02_01_2q03_01q03_03","q02_01_2q03_01q03_02","q02_01_2q02_02q06_06","q02_01_2q02_02q06_05","q02_01_2q02_02q06_04","q02_01_2q02_02q06_03","q02_01_2q02_02q06_02","q02_01_2q02_02q06_01","q02_01_2q02_02q05_05","q02_01_2q02_02q05_04","q02_01_2q02_02q05_03","q02_01_2q02_02q05_02","q02_01_2q02_02q05_01","q02_01_2q02_02q04_04","q02_01_2q02_02q04_03","q02_01_2q02_02q04_02","q02_01_2q02_02q04_01","q02_01_2q02_02q03_03","q02_01_2q02_02q03_02","q02_01_2q02_02q03_01","q01_01q03_03_2q05_05","q01_01q03_03_2q05_04","q01_01q03_03_2q05_03","q01_01q03_03_2q05_02","q01_01q03_03_2q05_01","q01_01q03_03_2q04_04","q01_01q03_03_2q04_03","q01_01q03_03_2q04_02","q01_01q03_03_2q04_01","q01_01q03_02q03_03_2","q01_01q03_02_2q05_05","q01_01q03_02_2q05_04","q01_01q03_02_2q05_03","q01_01q03_02_2q05_02","q01_01q03_02_2q05_01","q01_01q03_02_2q04_04","q01_01q03_02_2q04_03","q01_01q03_02_2q04_02","q01_01q03_02_2q04_01","q01_01q03_02_2q03_03","q01_01q03_01q03_03_2","q01_01q03_01q03_02_2","q01_01q03_01_2q05_05","q01_01q03_01_2q05_04","q01_01q03_01_2q05_03","q01_01q03_01_2q05_02","q01_01q03_01_2q05_01","q01_01q03_01_2q04_04","q01_01q03_01_2q04_03","q01_01q03_01_2q04_02","q01_01q03_01_2q04_01","q01_01q03_01_2q03_03","q01_01q03_01_2q03_02","q01_01q02_02q04_04_2","q01_01q02_02q04_03_2","q01_01q02_02q04_02_2","q01_01q02_02q04_01_2","q01_01q02_02q03_03_3","q01_01q02_02q03_03_2","q01_01q02_02q03_02_3","q01_01q02_02q03_02_2","q01_01q02_02q03_01_3","q01_01q02_02q03_01_2","q01_01q02_02_4q03_03","q01_01q02_02_4q03_02","q01_01q02_02_4q03_01","q01_01q02_02_3q05_05","q01_01q02_02_3q05_04","q01_01q02_02_3q05_03","q01_01q02_02_3q05_02","q01_01q02_02_3q05_01","q01_01q02_02_3q04_04","q01_01q02_02_3q04_03","q01_01q02_02_3q04_02","q01_01q02_02_3q04_01","q01_01q02_02_3q03_03","q01_01q02_02_3q03_02","q01_01q02_02_3q03_01","q01_01q02_02_2q06_06","q01_01q02_02_2q06_05","q01_01q02_02_2q06_04","q01_01q02_02_2q06_03","q01_01q02_02_2q06_02","q01_01q02_02_2q06_01","q01_01q02_02_2q05_05","q01_01q02_02_2q05_04","q01_01q02_02_2q05_03","q01_01q02_02_2q05_02","q01_01q02_02_2q05_01","q01_01q02_02_2q04_04","q01_01q02_02_2q04_03","q01_01q02_02_2q04_02","q01_01q02_02_2q04_01","q01_01q02_02_2q03_03","q01_01q02_02_2q03_02","q01_01q02_02_2q03_01","q01_01q02_01q04_04_2","q01_01q02_01q04_03_2","q01_01q02_01q04_02_2","q01_01q02_01q04_01_2","q01_01q02_01q03_03_3","q01_01q02_01q03_03_2","q01_01q02_01q03_02_3","q01_01q02_01q03_02_2","q01_01q02_01q03_01_3","q01_01q02_01q03_01_2","q01_01q02_01q02_02_4","q01_01q02_01q02_02_3","q01_01q02_01q02_02_2","q01_01q02_01_4q03_03","q01_01q02_01_4q03_02","q01_01q02_01_4q03_01","q01_01q02_01_4q02_02","q01_01q02_01_3q05_05","q01_01q02_01_3q05_04","q01_01q02_01_3q05_03","q01_01q02_01_3q05_02","q01_01q02_01_3q05_01","q01_01q02_01_3q04_04","q01_01q02_01_3q04_03","q01_01q02_01_3q04_02","q01_01q02_01_3q04_01","q01_01q02_01_3q03_03","q01_01q02_01_3q03_02","q01_01q02_01_3q03_01","q01_01q02_01_3q02_02","q01_01q02_01_2q06_06","q01_01q02_01_2q06_05","q01_01q02_01_2q06_04","q01_01q02_01_2q06_03","q01_01q02_01_2q06_02","q01_01q02_01_2q06_01","q01_01q02_01_2q05_05","q01_01q02_01_2q05_04","q01_01q02_01_2q05_03","q01_01q02_01_2q05_02","q01_01q02_01_2q05_01","q01_01q02_01_2q04_04","q01_01q02_01_2q04_03","q01_01q02_01_2q04_02","q01_01q02_01_2q04_01","q01_01q02_01_2q03_03","q01_01q02_01_2q03_02","q01_01q02_01_2q03_01","q01_01q02_01_2q02_02","q01_01_8q02_01q02_02","q01_01_7q02_02q03_03","q01_01_7q02_02q03_02","q01_01_7q02_02q03_01","q01_01_7q02_01q03_03","q01_01_7q02_01q03_02","q01_01_7q02_01q03_01","q01_01_7q02_01q02_02","q01_01_6q03_02q03_03","q01_01_6q03_01q03_03","q01_01_6q03_01q03_02","q01_01_6q02_02q04_04","q01_01_6q02_02q04_03","q01_01_6q02_02q04_02","q01_01_6q02_02q04_01","q01_01_6q02_02q03_03","q01_01_6q02_02q03_02","q01_01_6q02_02q03_01","q01_01_6q02_01q04_04","q01_01_6q02_01q04_03","q01_01_6q02_01q04_02","q01_01_6q02_01q04_01","q01_01_6q02_01q03_03","q01_01_6q02_01q03_02","q01_01_6q02_01q03_01","q01_01_6q02_01q02_02","q01_01_5q03_03q04_04","q01_01_5q03_03q04_03","q01_01_5q03_03q04_02","q01_01_5q03_03q04_01","q01_01_5q03_02q04_04","q01_01_5q03_02q04_03","q01_01_5q03_02q04_02","q01_01_5q03_02q04_01","q01_01_5q03_02q03_03","q01_01_5q03_01q04_04","q01_01_5q03_01q04_03","q01_01_5q03_01q04_02","q01_01_5q03_01q04_01","q01_01_5q03_01q03_03","q01_01_5q03_01q03_02","q01_01_5q02_02q05_05","q01_01_5q02_02q05_04","q01_01_5q02_02q05_03","q01_01_5q02_02q05_02","q01_01_5q02_02q05_01","q01_01_5q02_02q04_04","q01_01_5q02_02q04_03","q01_01_5q02_02q04_02","q01_01_5q02_02q04_01","q01_01_5q02_02q03_03","q01_01_5q02_02q03_02","q01_01_5q02_02q03_01","q01_01_5q02_01q05_05","q01_01_5q02_01q05_04","q01_01_5q02_01q05_03","q01_01_5q02_01q05_02","q01_01_5q02_01q05_01","q01_01_5q02_01q04_04","q01_01_5q02_01q04_03","q01_01_5q02_01q04_02","q01_01_5q02_01q04_01","q01_01_5q02_01q03_03","q01_01_5q02_01q03_02","q01_01_5q02_01q03_01","q01_01_5q02_01q02_02","q01_01_4q04_03q04_04","q01_01_4q04_02q04_04","q01_01_4q04_02q04_03","q01_01_4q04_01q04_04","q01_01_4q04_01q04_03","q01_01_4q04_01q04_02","q01_01_4q03_03q05_05","q01_01_4q03_03q05_04","q01_01_4q03_03q05_03","q01_01_4q03_03q05_02","q01_01_4q03_03q05_01","q01_01_4q03_03q04_04","q01_01_4q03_03q04_03","q01_01_4q03_03q04_02","q01_01_4q03_03q04_01","q01_01_4q03_02q05_05","q01_01_4q03_02q05_04","q01_01_4q03_02q05_03","q01_01_4q03_02q05_02","q01_01_4q03_02q05_01","q01_01_4q03_02q04_04","q01_01_4q03_02q04_03","q01_01_4q03_02q04_02","q01_01_4q03_02q04_01","q01_01_4q03_02q03_03","q01_01_4q03_01q05_05","q01_01_4q03_01q05_04","q01_01_4q03_01q05_03","q01_01_4q03_01q05_02","q01_01_4q03_01q05_01","q01_01_4q03_01q04_04","q01_01_4q03_01q04_03","q01_01_4q03_01q04_02","q01_01_4q03_01q04_01","q01_01_4q03_01q03_03","q01_01_4q03_01q03_02","q01_01_4q02_02q06_06","q01_01_4q02_02q06_05","q01_01_4q02_02q06_04","q01_01_4q02_02q06_03","q01_01_4q02_02q06_02","q01_01_4q02_02q06_01","q01_01_4q02_02q05_05","q01_01_4q02_02q05_04","q01_01_4q02_02q05_03","q01_01_4q02_02q05_02","q01_01_4q02_02q05_01","q01_01_4q02_02q04_04","q01_01_4q02_02q04_03","q01_01_4q02_02q04_02","q01_01_4q02_02q04_01","q01_01_4q02_02q03_03","q01_01_4q02_02q03_02","q01_01_4q02_02q03_01","q01_01_4q02_01q06_06","q01_01_4q02_01q06_05","q01_01_4q02_01q06_04","q01_01_4q02_01q06_03","q01_01_4q02_01q06_02","q01_01_4q02_01q06_01","q01_01_4q02_01q05_05","q01_01_4q02_01q05_04","q01_01_4q02_01q05_03","q01_01_4q02_01q05_02","q01_01_4q02_01q05_01","q01_01_4q02_01q04_04","q01_01_4q02_01q04_03","q01_01_4q02_01q04_02","q01_01_4q02_01q04_01","q01_01_4q02_01q03_03","q01_01_4q02_01q03_02","q01_01_4q02_01q03_01","q01_01_4q02_01q02_02","q01_01_3q04_04q05_05","q01_01_3q04_04q05_04","q01_01_3q04_04q05_03","q01_01_3q04_04q05_02","q01_01_3q04_04q05_01","q01_01_3q04_03q05_05","q01_01_3q04_03q05_04","q01_01_3q04_03q05_03","q01_01_3q04_03q05_02","q01_01_3q04_03q05_01","q01_01_3q04_03q04_04","q01_01_3q04_02q05_05","q01_01_3q04_02q05_04","q01_01_3q04_02q05_03","q01_01_3q04_02q05_02","q01_01_3q04_02q05_01","q01_01_3q04_02q04_04","q01_01_3q04_02q04_03","q01_01_3q04_01q05_05","q01_01_3q04_01q05_04","q01_01_3q04_01q05_03","q01_01_3q04_01q05_02","q01_01_3q04_01q05_01","q01_01_3q04_01q04_04","q01_01_3q04_01q04_03","q01_01_3q04_01q04_02","q01_01_3q03_03q06_06","q01_01_3q03_03q06_05","q01_01_3q03_03q06_04","q01_01_3q03_03q06_03","q01_01_3q03_03q06_02","q01_01_3q03_03q06_01","q01_01_3q03_03q05_05","q01_01_3q03_03q05_04","q01_01_3q03_03q05_03","q01_01_3q03_03q05_02","q01_01_3q03_03q05_01","q01_01_3q03_03q04_04","q01_01_3q03_03q04_03","q01_01_3q03_03q04_02","q01_01_3q03_03q04_01","q01_01_3q03_02q06_06","q01_01_3q03_02q06_05","q01_01_3q03_02q06_04","q01_01_3q03_02q06_03","q01_01_3q03_02q06_02","q01_01_3q03_02q06_01","q01_01_3q03_02q05_05","q01_01_3q03_02q05_04","q01_01_3q03_02q05_03","q01_01_3q03_02q05_02","q01_01_3q03_02q05_01","q01_01_3q03_02q04_04","q01_01_3q03_02q04_03","q01_01_3q03_02q04_02","q01_01_3q03_02q04_01","q01_01_3q03_02q03_03","q01_01_3q03_01q06_06","q01_01_3q03_01q06_05","q01_01_3q03_01q06_04","q01_01_3q03_01q06_03","q01_01_3q03_01q06_02","q01_01_3q03_01q06_01","q01_01_3q03_01q05_05","q01_01_3q03_01q05_04","q01_01_3q03_01q05_03","q01_01_3q03_01q05_02","q01_01_3q03_01q05_01","q01_01_3q03_01q04_04","q01_01_3q03_01q04_03","q01_01_3q03_01q04_02","q01_01_3q03_01q04_01","q01_01_3q03_01q03_03","q01_01_3q03_01q03_02","q01_01_3q02_02q06_06","q01_01_3q02_02q06_05","q01_01_3q02_02q06_04","q01_01_3q02_02q06_03","q01_01_3q02_02q06_02","q01_01_3q02_02q06_01","q01_01_3q02_02q05_05","q01_01_3q02_02q05_04","q01_01_3q02_02q05_03","q01_01_3q02_02q05_02","q01_01_3q02_02q05_01","q01_01_3q02_02q04_04","q01_01_3q02_02q04_03","q01_01_3q02_02q04_02","q01_01_3q02_02q04_01","q01_01_3q02_02q03_03","q01_01_3q02_02q03_02","q01_01_3q02_02q03_01","q01_01_3q02_01q06_06","q01_01_3q02_01q06_05","q01_01_3q02_01q06_04","q01_01_3q02_01q06_03","q01_01_3q02_01q06_02","q01_01_3q02_01q06_01","q01_01_3q02_01q05_05","q01_01_3q02_01q05_04","q01_01_3q02_01q05_03","q01_01_3q02_01q05_02","q01_01_3q02_01q05_01","q01_01_3q02_01q04_04","q01_01_3q02_01q04_03","q01_01_3q02_01q04_02","q01_01_3q02_01q04_01","q01_01_3q02_01q03_03","q01_01_3q02_01q03_02","q01_01_3q02_01q03_01","q01_01_3q02_01q02_02","q01_01_2q05_04q05_05","q01_01_2q05_03q05_05","q01_01_2q05_03q05_04","q01_01_2q05_02q05_05","q01_01_2q05_02q05_04","q01_01_2q05_02q05_03","q01_01_2q05_01q05_05","q01_01_2q05_01q05_04","q01_01_2q05_01q05_03","q01_01_2q05_01q05_02","q01_01_2q04_04q06_06","q01_01_2q04_04q06_05","q01_01_2q04_04q06_04","q01_01_2q04_04q06_03","q01_01_2q04_04q06_02","q01_01_2q04_04q06_01","q01_01_2q04_04q05_05","q01_01_2q04_04q05_04","q01_01_2q04_04q05_03","q01_01_2q04_04q05_02","q01_01_2q04_04q05_01","q01_01_2q04_03q06_06","q01_01_2q04_03q06_05","q01_01_2q04_03q06_04","q01_01_2q04_03q06_03","q01_01_2q04_03q06_02","q01_01_2q04_03q06_01","q01_01_2q04_03q05_05","q01_01_2q04_03q05_04","q01_01_2q04_03q05_03","q01_01_2q04_03q05_02","q01_01_2q04_03q05_01","q01_01_2q04_03q04_04","q01_01_2q04_02q06_06","q01_01_2q04_02q06_05","q01_01_2q04_02q06_04","q01_01_2q04_02q06_03","q01_01_2q04_02q06_02","q01_01_2q04_02q06_01","q01_01_2q04_02q05_05","q01_01_2q04_02q05_04","q01_01_2q04_02q05_03","q01_01_2q04_02q05_02","q01_01_2q04_02q05_01","q01_01_2q04_02q04_04","q01_01_2q04_02q04_03","q01_01_2q04_01q06_06","q01_01_2q04_01q06_05","q01_01_2q04_01q06_04","q01_01_2q04_01q06_03","q01_01_2q04_01q06_02","q01_01_2q04_01q06_01","q01_01_2q04_01q05_05","q01_01_2q04_01q05_04","q01_01_2q04_01q05_03","q01_01_2q04_01q05_02","q01_01_2q04_01q05_01","q01_01_2q04_01q04_04","q01_01_2q04_01q04_03","q01_01_2q04_01q04_02","q01_01_2q03_03q06_06","q01_01_2q03_03q06_05","q01_01_2q03_03q06_04","q01_01_2q03_03q06_03","q01_01_2q03_03q06_02","q01_01_2q03_03q06_01","q01_01_2q03_03q05_05","q01_01_2q03_03q05_04","q01_01_2q03_03q05_03","q01_01_2q03_03q05_02","q01_01_2q03_03q05_01","q01_01_2q03_03q04_04","q01_01_2q03_03q04_03","q01_01_2q03_03q04_02","q01_01_2q03_03q04_01","q01_01_2q03_02q06_06","q01_01_2q03_02q06_05","q01_01_2q03_02q06_04","q01_01_2q03_02q06_03","q01_01_2q03_02q06_02","q01_01_2q03_02q06_01","q01_01_2q03_02q05_05","q01_01_2q03_02q05_04","q01_01_2q03_02q05_03","q01_01_2q03_02q05_02","q01_01_2q03_02q05_01","q01_01_2q03_02q04_04","q01_01_2q03_02q04_03","q01_01_2q03_02q04_02","q01_01_2q03_02q04_01","q01_01_2q03_02q03_03","q01_01_2q03_01q06_06","q01_01_2q03_01q06_05","q01_01_2q03_01q06_04","q01_01_2q03_01q06_03","q01_01_2q03_01q06_02","q01_01_2q03_01q06_01","q01_01_2q03_01q05_05","q01_01_2q03_01q05_04","q01_01_2q03_01q05_03","q01_01_2q03_01q05_02","q01_01_2q03_01q05_01","q01_01_2q03_01q04_04","q01_01_2q03_01q04_03","q01_01_2q03_01q04_02","q01_01_2q03_01q04_01","q01_01_2q03_01q03_03","q01_01_2q03_01q03_02","q01_01_2q02_02q06_06","q01_01_2q02_02q06_05","q01_01_2q02_02q06_04","q01_01_2q02_02q06_03","q01_01_2q02_02q06_02","q01_01_2q02_02q06_01","q01_01_2q02_02q05_05","q01_01_2q02_02q05_04","q01_01_2q02_02q05_03","q01_01_2q02_02q05_02","q01_01_2q02_02q05_01","q01_01_2q02_02q04_04","q01_01_2q02_02q04_03","q01_01_2q02_02q04_02","q01_01_2q02_02q04_01","q01_01_2q02_02q03_03","q01_01_2q02_02q03_02","q01_01_2q02_02q03_01","q01_01_2q02_01q06_06","q01_01_2q02_01q06_05","q01_01_2q02_01q06_04","q01_01_2q02_01q06_03","q01_01_2q02_01q06_02","q01_01_2q02_01q06_01","q01_01_2q02_01q05_05","q01_01_2q02_01q05_04","q01_01_2q02_01q05_03","q01_01_2q02_01q05_02","q01_01_2q02_01q05_01","q01_01_2q02_01q04_04","q01_01_2q02_01q04_03","q01_01_2q02_01q04_02","q01_01_2q02_01q04_01","q01_01_2q02_01q03_03","q01_01_2q02_01q03_02","q01_01_2q02_01q03_01","q01_01_2q02_01q02_02","q03_02q03_03q06_06","q03_02q03_03q06_05","q03_02q03_03q06_04","q03_02q03_03q06_03","q03_02q03_03q06_02","q03_02q03_03q06_01","q03_02q03_03q05_05","q03_02q03_03q05_04","q03_02q03_03q05_03","q03_02q03_03q05_02","q03_02q03_03q05_01","q03_02q03_03q04_04","q03_02q03_03q04_03","q03_02q03_03q04_02","q03_02q03_03q04_01","q03_01q03_03q06_06","q03_01q03_03q06_05","q03_01q03_03q06_04","q03_01q03_03q06_03","q03_01q03_03q06_02","q03_01q03_03q06_01","q03_01q03_03q05_05","q03_01q03_03q05_04","q03_01q03_03q05_03","q03_01q03_03q05_02","q03_01q03_03q05_01","q03_01q03_03q04_04","q03_01q03_03q04_03","q03_01q03_03q04_02","q03_01q03_03q04_01","q03_01q03_02q06_06","q03_01q03_02q06_05","q03_01q03_02q06_04","q03_01q03_02q06_03","q03_01q03_02q06_02","q03_01q03_02q06_01","q03_01q03_02q05_05","q03_01q03_02q05_04","q03_01q03_02q05_03","q03_01q03_02q05_02","q03_01q03_02q05_01","q03_01q03_02q04_04","q03_01q03_02q04_03","q03_01q03_02q04_02","q03_01q03_02q04_01","q03_01q03_02q03_03","q02_02q04_04q06_06","q02_02q04_04q06_05","q02_02q04_04q06_04","q02_02q04_04q06_03","q02_02q04_04q06_02","q02_02q04_04q06_01","q02_02q04_04q05_05","q02_02q04_04q05_04","q02_02q04_04q05_03","q02_02q04_04q05_02","q02_02q04_04q05_01","q02_02q04_03q06_06","q02_02q04_03q06_05","q02_02q04_03q06_04","q02_02q04_03q06_03","q02_02q04_03q06_02","q02_02q04_03q06_01","q02_02q04_03q05_05","q02_02q04_03q05_04","q02_02q04_03q05_03","q02_02q04_03q05_02","q02_02q04_03q05_01","q02_02q04_03q04_04","q02_02q04_02q06_06","q02_02q04_02q06_05","q02_02q04_02q06_04","q02_02q04_02q06_03","q02_02q04_02q06_02","q02_02q04_02q06_01","q02_02q04_02q05_05","q02_02q04_02q05_04","q02_02q04_02q05_03","q02_02q04_02q05_02","q02_02q04_02q05_01","q02_02q04_02q04_04","q02_02q04_02q04_03","q02_02q04_01q06_06","q02_02q04_01q06_05","q02_02q04_01q06_04","q02_02q04_01q06_03","q02_02q04_01q06_02","q02_02q04_01q06_01","q02_02q04_01q05_05","q02_02q04_01q05_04","q02_02q04_01q05_03","q02_02q04_01q05_02","q02_02q04_01q05_01","q02_02q04_01q04_04","q02_02q04_01q04_03","q02_02q04_01q04_02","q02_02q03_03q06_06","q02_02q03_03q06_05","q02_02q03_03q06_04","q02_02q03_03q06_03","q02_02q03_03q06_02","q02_02q03_03q06_01","q02_02q03_03q05_05","q02_02q03_03q05_04","q02_02q03_03q05_03","q02_02q03_03q05_02","q02_02q03_03q05_01","q02_02q03_03q04_04","q02_02q03_03q04_03","q02_02q03_03q04_02","q02_02q03_03q04_01","q02_02q03_02q06_06","q02_02q03_02q06_05","q02_02q03_02q06_04","q02_02q03_02q06_03","q02_02q03_02q06_02","q02_02q03_02q06_01","q02_02q03_02q05_05","q02_02q03_02q05_04","q02_02q03_02q05_03","q02_02q03_02q05_02","q02_02q03_02q05_01","q02_02q03_02q04_04","q02_02q03_02q04_03","q02_02q03_02q04_02","q02_02q03_02q04_01","q02_02q03_02q03_03","q02_02q03_01q06_06","q02_02q03_01q06_05","q02_02q03_01q06_04","q02_02q03_01q06_03","q02_02q03_01q06_02","q02_02q03_01q06_01","q02_02q03_01q05_05","q02_02q03_01q05_04","q02_02q03_01q05_03","q02_02q03_01q05_02","q02_02q03_01q05_01","q02_02q03_01q04_04","q02_02q03_01q04_03","q02_02q03_01q04_02","q02_02q03_01q04_01","q02_02q03_01q03_03","q02_02q03_01q03_02","q02_01q04_04q06_06","q02_01q04_04q06_05","q02_01q04_04q06_04","q02_01q04_04q06_03","q02_01q04_04q06_02","q02_01q04_04q06_01","q02_01q04_04q05_05","q02_01q04_04q05_04","q02_01q04_04q05_03","q02_01q04_04q05_02","q02_01q04_04q05_01","q02_01q04_03q06_06","q02_01q04_03q06_05","q02_01q04_03q06_04","q02_01q04_03q06_03","q02_01q04_03q06_02","q02_01q04_03q06_01","q02_01q04_03q05_05","q02_01q04_03q05_04","q02_01q04_03q05_03","q02_01q04_03q05_02","q02_01q04_03q05_01","q02_01q04_03q04_04","q02_01q04_02q06_06","q02_01q04_02q06_05","q02_01q04_02q06_04","q02_01q04_02q06_03","q02_01q04_02q06_02","q02_01q04_02q06_01","q02_01q04_02q05_05","q02_01q04_02q05_04","q02_01q04_02q05_03","q02_01q04_02q05_02","q02_01q04_02q05_01","q02_01q04_02q04_04","q02_01q04_02q04_03","q02_01q04_01q06_06","q02_01q04_01q06_05","q02_01q04_01q06_04","q02_01q04_01q06_03","q02_01q04_01q06_02","q02_01q04_01q06_01","q02_01q04_01q05_05","q02_01q04_01q05_04","q02_01q04_01q05_03","q02_01q04_01q05_02","q02_01q04_01q05_01","q02_01q04_01q04_04","q02_01q04_01q04_03","q02_01q04_01q04_02","q02_01q03_03q06_06","q02_01q03_03q06_05","q02_01q03_03q06_04","q02_01q03_03q06_03","q02_01q03_03q06_02","q02_01q03_03q06_01","q02_01q03_03q05_05","q02_01q03_03q05_04","q02_01q03_03q05_03","q02_01q03_03q05_02","q02_01q03_03q05_01","q02_01q03_03q04_04","q02_01q03_03q04_03","q02_01q03_03q04_02","q02_01q03_03q04_01","q02_01q03_02q06_06","q02_01q03_02q06_05","q02_01q03_02q06_04","q02_01q03_02q06_03","q02_01q03_02q06_02","q02_01q03_02q06_01","q02_01q03_02q05_05","q02_01q03_02q05_04","q02_01q03_02q05_03","q02_01q03_02q05_02","q02_01q03_02q05_01","q02_01q03_02q04_04","q02_01q03_02q04_03","q02_01q03_02q04_02","q02_01q03_02q04_01","q02_01q03_02q03_03","q02_01q03_01q06_06","q02_01q03_01q06_05","q02_01q03_01q06_04","q02_01q03_01q06_03","q02_01q03_01q06_02","q02_01q03_01q06_01","q02_01q03_01q05_05","q02_01q03_01q05_04","q02_01q03_01q05_03","q02_01q03_01q05_02","q02_01q03_01q05_01","q02_01q03_01q04_04","q02_01q03_01q04_03","q02_01q03_01q04_02","q02_01q03_01q04_01","q02_01q03_01q03_03","q02_01q03_01q03_02","q02_01q02_02q06_06","q02_01q02_02q06_05","q02_01q02_02q06_04","q02_01q02_02q06_03","q02_01q02_02q06_02","q02_01q02_02q06_01","q02_01q02_02q05_05","q02_01q02_02q05_04","q02_01q02_02q05_03","q02_01q02_02q05_02","q02_01q02_02q05_01","q02_01q02_02q04_04","q02_01q02_02q04_03","q02_01q02_02q04_02","q02_01q02_02q04_01","q02_01q02_02q03_03","q02_01q02_02q03_02","q02_01q02_02q03_01","q01_01q05_05q06_06","q01_01q05_05q06_05","q01_01q05_05q06_04","q01_01q05_05q06_03","q01_01q05_05q06_02","q01_01q05_05q06_01","q01_01q05_04q06_06","q01_01q05_04q06_05","q01_01q05_04q06_04","q01_01q05_04q06_03","q01_01q05_04q06_02","q01_01q05_04q06_01","q01_01q05_04q05_05","q01_01q05_03q06_06","q01_01q05_03q06_05","q01_01q05_03q06_04","q01_01q05_03q06_03","q01_01q05_03q06_02","q01_01q05_03q06_01","q01_01q05_03q05_05","q01_01q05_03q05_04","q01_01q05_02q06_06","q01_01q05_02q06_05","q01_01q05_02q06_04","q01_01q05_02q06_03","q01_01q05_02q06_02","q01_01q05_02q06_01","q01_01q05_02q05_05","q01_01q05_02q05_04","q01_01q05_02q05_03","q01_01q05_01q06_06","q01_01q05_01q06_05","q01_01q05_01q06_04","q01_01q05_01q06_03","q01_01q05_01q06_02","q01_01q05_01q06_01","q01_01q05_01q05_05","q01_01q05_01q05_04","q01_01q05_01q05_03","q01_01q05_01q05_02","q01_01q04_04q06_06","q01_01q04_04q06_05","q01_01q04_04q06_04","q01_01q04_04q06_03","q01_01q04_04q06_02","q01_01q04_04q06_01","q01_01q04_04q05_05","q01_01q04_04q05_04","q01_01q04_04q05_03","q01_01q04_04q05_02","q01_01q04_04q05_01","q01_01q04_03q06_06","q01_01q04_03q06_05","q01_01q04_03q06_04","q01_01q04_03q06_03","q01_01q04_03q06_02","q01_01q04_03q06_01","q01_01q04_03q05_05","q01_01q04_03q05_04","q01_01q04_03q05_03","q01_01q04_03q05_02","q01_01q04_03q05_01","q01_01q04_03q04_04","q01_01q04_02q06_06","q01_01q04_02q06_05","q01_01q04_02q06_04","q01_01q04_02q06_03","q01_01q04_02q06_02","q01_01q04_02q06_01","q01_01q04_02q05_05","q01_01q04_02q05_04","q01_01q04_02q05_03","q01_01q04_02q05_02","q01_01q04_02q05_01","q01_01q04_02q04_04","q01_01q04_02q04_03","q01_01q04_01q06_06","q01_01q04_01q06_05","q01_01q04_01q06_04","q01_01q04_01q06_03","q01_01q04_01q06_02","q01_01q04_01q06_01","q01_01q04_01q05_05","q01_01q04_01q05_04","q01_01q04_01q05_03","q01_01q04_01q05_02","q01_01q04_01q05_01","q01_01q04_01q04_04","q01_01q04_01q04_03","q01_01q04_01q04_02","q01_01q03_03q06_06","q01_01q03_03q06_05","q01_01q03_03q06_04","q01_01q03_03q06_03","q01_01q03_03q06_02","q01_01q03_03q06_01","q01_01q03_03q05_05","q01_01q03_03q05_04","q01_01q03_03q05_03","q01_01q03_03q05_02","q01_01q03_03q05_01","q01_01q03_03q04_04","q01_01q03_03q04_03","q01_01q03_03q04_02","q01_01q03_03q04_01","q01_01q03_02q06_06","q01_01q03_02q06_05","q01_01q03_02q06_04","q01_01q03_02q06_03","q01_01q03_02q06_02","q01_01q03_02q06_01","q01_01q03_02q05_05","q01_01q03_02q05_04","q01_01q03_02q05_03","q01_01q03_02q05_02","q01_01q03_02q05_01","q01_01q03_02q04_04","q01_01q03_02q04_03","q01_01q03_02q04_02","q01_01q03_02q04_01","q01_01q03_02q03_03","q01_01q03_01q06_06","q01_01q03_01q06_05","q01_01q03_01q06_04","q01_01q03_01q06_03","q01_01q03_01q06_02","q01_01q03_01q06_01","q01_01q03_01q05_05","q01_01q03_01q05_04","q01_01q03_01q05_03","q01_01q03_01q05_02","q01_01q03_01q05_01","q01_01q03_01q04_04","q01_01q03_01q04_03","q01_01q03_01q04_02","q01_01q03_01q04_01","q01_01q03_01q03_03","q01_01q03_01q03_02","q01_01q02_02q06_06","q01_01q02_02q06_05","q01_01q02_02q06_04","q01_01q02_02q06_03","q01_01q02_02q06_02","q01_01q02_02q06_01","q01_01q02_02q05_05","q01_01q02_02q05_04","q01_01q02_02q05_03","q01_01q02_02q05_02","q01_01q02_02q05_01","q01_01q02_02q04_04","q01_01q02_02q04_03","q01_01q02_02q04_02","q01_01q02_02q04_01","q01_01q02_02q03_03","q01_01q02_02q03_02","q01_01q02_02q03_01","q01_01q02_01q06_06","q01_01q02_01q06_05","q01_01q02_01q06_04","q01_01q02_01q06_03","q01_01q02_01q06_02","q01_01q02_01q06_01","q01_01q02_01q05_05","q01_01q02_01q05_04","q01_01q02_01q05_03","q01_01q02_01q05_02","q01_01q02_01q05_01","q01_01q02_01q04_04","q01_01q02_01q04_03","q01_01q02_01q04_02","q01_01q02_01q04_01","q01_01q02_01q03_03","q01_01q02_01q03_02","q01_01q02_01q03_01","q01_01q02_01q02_02","q03_02_2q03_03_2","q03_01_2q03_03_2","q03_01_2q03_02_2","q02_02_3q03_03_2","q02_02_3q03_02_2","q02_02_3q03_01_2","q02_02_2q04_04_2","q02_02_2q04_03_2","q02_02_2q04_02_2","q02_02_2q04_01_2","q02_02_2q03_03_2","q02_02_2q03_02_2","q02_02_2q03_01_2","q02_01_4q02_02_2","q02_01_3q03_03_2","q02_01_3q03_02_2","q02_01_3q03_01_2","q02_01_3q02_02_3","q02_01_3q02_02_2","q02_01_2q04_04_2","q02_01_2q04_03_2","q02_01_2q04_02_2","q02_01_2q04_01_2","q02_01_2q03_03_2","q02_01_2q03_02_2","q02_01_2q03_01_2","q02_01_2q02_02_4","q02_01_2q02_02_3","q02_01_2q02_02_2","q01_01_8q02_02_2","q01_01_8q02_01_2","q01_01_7q02_02_2","q01_01_7q02_01_2","q01_01_6q03_03_2","q01_01_6q03_02_2","q01_01_6q03_01_2","q01_01_6q02_02_3","q01_01_6q02_02_2","q01_01_6q02_01_3","q01_01_6q02_01_2","q01_01_5q03_03_2","q01_01_5q03_02_2","q01_01_5q03_01_2","q01_01_5q02_02_3","q01_01_5q02_02_2","q01_01_5q02_01_3","q01_01_5q02_01_2","q01_01_4q04_04_2","q01_01_4q04_03_2","q01_01_4q04_02_2","q01_01_4q04_01_2","q01_01_4q03_03_2","q01_01_4q03_02_2","q01_01_4q03_01_2","q01_01_4q02_02_4","q01_01_4q02_02_3","q01_01_4q02_02_2","q01_01_4q02_01_4","q01_01_4q02_01_3","q01_01_4q02_01_2","q01_01_3q04_04_2","q01_01_3q04_03_2","q01_01_3q04_02_2","q01_01_3q04_01_2","q01_01_3q03_03_3","q01_01_3q03_03_2","q01_01_3q03_02_3","q01_01_3q03_02_2","q01_01_3q03_01_3","q01_01_3q03_01_2","q01_01_3q02_02_4","q01_01_3q02_02_3","q01_01_3q02_02_2","q01_01_3q02_01_4","q01_01_3q02_01_3","q01_01_3q02_01_2","q01_01_2q05_05_2","q01_01_2q05_04_2","q01_01_2q05_03_2","q01_01_2q05_02_2","q01_01_2q05_01_2","q01_01_2q04_04_2","q01_01_2q04_03_2","q01_01_2q04_02_2","q01_01_2q04_01_2","q01_01_2q03_03_3","q01_01_2q03_03_2","q01_01_2q03_02_3","q01_01_2q03_02_2","q01_01_2q03_01_3","q01_01_2q03_01_2","q01_01_2q02_02_5","q01_01_2q02_02_4","q01_01_2q02_02_3","q01_01_2q02_02_2","q01_01_2q02_01_5","q01_01_2q02_01_4","q01_01_2q02_01_3","q01_01_2q02_01_2","q01_01_10q02_02","q01_01_10q02_01","q03_03_2q06_06","q03_03_2q06_05","q03_03_2q06_04","q03_03_2q06_03","q03_03_2q06_02","q03_03_2q06_01","q03_03_2q05_05","q03_03_2q05_04","q03_03_2q05_03","q03_03_2q05_02","q03_03_2q05_01","q03_03_2q04_04","q03_03_2q04_03","q03_03_2q04_02","q03_03_2q04_01","q03_02q03_03_3","q03_02q03_03_2","q03_02_3q03_03","q03_02_2q06_06","q03_02_2q06_05","q03_02_2q06_04","q03_02_2q06_03","q03_02_2q06_02","q03_02_2q06_01","q03_02_2q05_05","q03_02_2q05_04","q03_02_2q05_03","q03_02_2q05_02","q03_02_2q05_01","q03_02_2q04_04","q03_02_2q04_03","q03_02_2q04_02","q03_02_2q04_01","q03_02_2q03_03","q03_01q03_03_3","q03_01q03_03_2","q03_01q03_02_3","q03_01q03_02_2","q03_01_3q03_03","q03_01_3q03_02","q03_01_2q06_06","q03_01_2q06_05","q03_01_2q06_04","q03_01_2q06_03","q03_01_2q06_02","q03_01_2q06_01","q03_01_2q05_05","q03_01_2q05_04","q03_01_2q05_03","q03_01_2q05_02","q03_01_2q05_01","q03_01_2q04_04","q03_01_2q04_03","q03_01_2q04_02","q03_01_2q04_01","q03_01_2q03_03","q03_01_2q03_02","q02_02q04_04_2","q02_02q04_03_2","q02_02q04_02_2","q02_02q04_01_2","q02_02q03_03_3","q02_02q03_03_2","q02_02q03_02_3","q02_02q03_02_2","q02_02q03_01_3","q02_02q03_01_2","q02_02_4q04_04","q02_02_4q04_03","q02_02_4q04_02","q02_02_4q04_01","q02_02_4q03_03","q02_02_4q03_02","q02_02_4q03_01","q02_02_3q06_06","q02_02_3q06_05","q02_02_3q06_04","q02_02_3q06_03","q02_02_3q06_02","q02_02_3q06_01","q02_02_3q05_05","q02_02_3q05_04","q02_02_3q05_03","q02_02_3q05_02","q02_02_3q05_01","q02_02_3q04_04","q02_02_3q04_03","q02_02_3q04_02","q02_02_3q04_01","q02_02_3q03_03","q02_02_3q03_02","q02_02_3q03_01","q02_02_2q06_06","q02_02_2q06_05","q02_02_2q06_04","q02_02_2q06_03","q02_02_2q06_02","q02_02_2q06_01","q02_02_2q05_05","q02_02_2q05_04","q02_02_2q05_03","q02_02_2q05_02","q02_02_2q05_01","q02_02_2q04_04","q02_02_2q04_03","q02_02_2q04_02","q02_02_2q04_01","q02_02_2q03_03","q02_02_2q03_02","q02_02_2q03_01","q02_01q04_04_2","q02_01q04_03_2","q02_01q04_02_2","q02_01q04_01_2","q02_01q03_03_3","q02_01q03_03_2","q02_01q03_02_3","q02_01q03_02_2","q02_01q03_01_3","q02_01q03_01_2","q02_01q02_02_5","q02_01q02_02_4","q02_01q02_02_3","q02_01q02_02_2","q02_01_5q02_02","q02_01_4q04_04","q02_01_4q04_03","q02_01_4q04_02","q02_01_4q04_01","q02_01_4q03_03","q02_01_4q03_02","q02_01_4q03_01","q02_01_4q02_02","q02_01_3q06_06","q02_01_3q06_05","q02_01_3q06_04","q02_01_3q06_03","q02_01_3q06_02","q02_01_3q06_01","q02_01_3q05_05","q02_01_3q05_04","q02_01_3q05_03","q02_01_3q05_02","q02_01_3q05_01","q02_01_3q04_04","q02_01_3q04_03","q02_01_3q04_02","q02_01_3q04_01","q02_01_3q03_03","q02_01_3q03_02","q02_01_3q03_01","q02_01_3q02_02","q02_01_2q06_06","q02_01_2q06_05","q02_01_2q06_04","q02_01_2q06_03","q02_01_2q06_02","q02_01_2q06_01","q02_01_2q05_05","q02_01_2q05_04","q02_01_2q05_03","q02_01_2q05_02","q02_01_2q05_01","q02_01_2q04_04","q02_01_2q04_03","q02_01_2q04_02","q02_01_2q04_01","q02_01_2q03_03","q02_01_2q03_02","q02_01_2q03_01","q02_01_2q02_02","q01_01q05_05_2","q01_01q05_04_2","q01_01q05_03_2","q01_01q05_02_2","q01_01q05_01_2","q01_01q04_04_2","q01_01q04_03_2","q01_01q04_02_2","q01_01q04_01_2","q01_01q03_03_3","q01_01q03_03_2","q01_01q03_02_3","q01_01q03_02_2","q01_01q03_01_3","q01_01q03_01_2","q01_01q02_02_5","q01_01q02_02_4","q01_01q02_02_3","q01_01q02_02_2","q01_01q02_01_5","q01_01q02_01_4","q01_01q02_01_3","q01_01q02_01_2","q01_01_9q03_03","q01_01_9q03_02","q01_01_9q03_01","q01_01_9q02_02","q01_01_9q02_01","q01_01_8q04_04","q01_01_8q04_03","q01_01_8q04_02","q01_01_8q04_01","q01_01_8q03_03","q01_01_8q03_02","q01_01_8q03_01","q01_01_8q02_02","q01_01_8q02_01","q01_01_7q05_05","q01_01_7q05_04","q01_01_7q05_03","q01_01_7q05_02","q01_01_7q05_01","q01_01_7q04_04","q01_01_7q04_03","q01_01_7q04_02","q01_01_7q04_01","q01_01_7q03_03","q01_01_7q03_02","q01_01_7q03_01","q01_01_7q02_02","q01_01_7q02_01","q01_01_6q06_06","q01_01_6q06_05","q01_01_6q06_04","q01_01_6q06_03","q01_01_6q06_02","q01_01_6q06_01","q01_01_6q05_05","q01_01_6q05_04","q01_01_6q05_03","q01_01_6q05_02","q01_01_6q05_01","q01_01_6q04_04","q01_01_6q04_03","q01_01_6q04_02","q01_01_6q04_01","q01_01_6q03_03","q01_01_6q03_02","q01_01_6q03_01","q01_01_6q02_02","q01_01_6q02_01","q01_01_5q06_06","q01_01_5q06_05","q01_01_5q06_04","q01_01_5q06_03","q01_01_5q06_02","q01_01_5q06_01","q01_01_5q05_05","q01_01_5q05_04","q01_01_5q05_03","q01_01_5q05_02","q01_01_5q05_01","q01_01_5q04_04","q01_01_5q04_03","q01_01_5q04_02","q01_01_5q04_01","q01_01_5q03_03","q01_01_5q03_02","q01_01_5q03_01","q01_01_5q02_02","q01_01_5q02_01","q01_01_4q06_06","q01_01_4q06_05","q01_01_4q06_04","q01_01_4q06_03","q01_01_4q06_02","q01_01_4q06_01","q01_01_4q05_05","q01_01_4q05_04","q01_01_4q05_03","q01_01_4q05_02","q01_01_4q05_01","q01_01_4q04_04","q01_01_4q04_03","q01_01_4q04_02","q01_01_4q04_01","q01_01_4q03_03","q01_01_4q03_02","q01_01_4q03_01","q01_01_4q02_02","q01_01_4q02_01","q01_01_3q06_06","q01_01_3q06_05","q01_01_3q06_04","q01_01_3q06_03","q01_01_3q06_02","q01_01_3q06_01","q01_01_3q05_05","q01_01_3q05_04","q01_01_3q05_03","q01_01_3q05_02","q01_01_3q05_01","q01_01_3q04_04","q01_01_3q04_03","q01_01_3q04_02","q01_01_3q04_01","q01_01_3q03_03","q01_01_3q03_02","q01_01_3q03_01","q01_01_3q02_02","q01_01_3q02_01","q01_01_2q06_06","q01_01_2q06_05","q01_01_2q06_04","q01_01_2q06_03","q01_01_2q06_02","q01_01_2q06_01","q01_01_2q05_05","q01_01_2q05_04","q01_01_2q05_03","q01_01_2q05_02","q01_01_2q05_01","q01_01_2q04_04","q01_01_2q04_03","q01_01_2q04_02","q01_01_2q04_01","q01_01_2q03_03","q01_01_2q03_02","q01_01_2q03_01","q01_01_2q02_02","q01_01_2q02_01","q06_05q06_06","q06_04q06_06","q06_04q06_05","q06_03q06_06","q06_03q06_05","q06_03q06_04","q06_02q06_06","q06_02q06_05","q06_02q06_04","q06_02q06_03","q06_01q06_06","q06_01q06_05","q06_01q06_04","q06_01q06_03","q06_01q06_02","q05_05q06_06","q05_05q06_05","q05_05q06_04","q05_05q06_03","q05_05q06_02","q05_05q06_01","q05_04q06_06","q05_04q06_05","q05_04q06_04","q05_04q06_03","q05_04q06_02","q05_04q06_01","q05_04q05_05","q05_03q06_06","q05_03q06_05","q05_03q06_04","q05_03q06_03","q05_03q06_02","q05_03q06_01","q05_03q05_05","q05_03q05_04","q05_02q06_06","q05_02q06_05","q05_02q06_04","q05_02q06_03","q05_02q06_02","q05_02q06_01","q05_02q05_05","q05_02q05_04","q05_02q05_03","q05_01q06_06","q05_01q06_05","q05_01q06_04","q05_01q06_03","q05_01q06_02","q05_01q06_01","q05_01q05_05","q05_01q05_04","q05_01q05_03","q05_01q05_02","q04_04q06_06","q04_04q06_05","q04_04q06_04","q04_04q06_03","q04_04q06_02","q04_04q06_01","q04_04q05_05","q04_04q05_04","q04_04q05_03","q04_04q05_02","q04_04q05_01","q04_03q06_06","q04_03q06_05","q04_03q06_04","q04_03q06_03","q04_03q06_02","q04_03q06_01","q04_03q05_05","q04_03q05_04","q04_03q05_03","q04_03q05_02","q04_03q05_01","q04_03q04_04","q04_02q06_06","q04_02q06_05","q04_02q06_04","q04_02q06_03","q04_02q06_02","q04_02q06_01","q04_02q05_05","q04_02q05_04","q04_02q05_03","q04_02q05_02","q04_02q05_01","q04_02q04_04","q04_02q04_03","q04_01q06_06","q04_01q06_05","q04_01q06_04","q04_01q06_03","q04_01q06_02","q04_01q06_01","q04_01q05_05","q04_01q05_04","q04_01q05_03","q04_01q05_02","q04_01q05_01","q04_01q04_04","q04_01q04_03","q04_01q04_02","q03_03q06_06","q03_03q06_05","q03_03q06_04","q03_03q06_03","q03_03q06_02","q03_03q06_01","q03_03q05_05","q03_03q05_04","q03_03q05_03","q03_03q05_02","q03_03q05_01","q03_03q04_04","q03_03q04_03","q03_03q04_02","q03_03q04_01","q03_02q06_06","q03_02q06_05","q03_02q06_04","q03_02q06_03","q03_02q06_02","q03_02q06_01","q03_02q05_05","q03_02q05_04","q03_02q05_03","q03_02q05_02","q03_02q05_01","q03_02q04_04","q03_02q04_03","q03_02q04_02","q03_02q04_01","q03_02q03_03","q03_01q06_06","q03_01q06_05","q03_01q06_04","q03_01q06_03","q03_01q06_02","q03_01q06_01","q03_01q05_05","q03_01q05_04","q03_01q05_03","q03_01q05_02","q03_01q05_01","q03_01q04_04","q03_01q04_03","q03_01q04_02","q03_01q04_01","q03_01q03_03","q03_01q03_02","q02_02q06_06","q02_02q06_05","q02_02q06_04","q02_02q06_03","q02_02q06_02","q02_02q06_01","q02_02q05_05","q02_02q05_04","q02_02q05_03","q02_02q05_02","q02_02q05_01","q02_02q04_04","q02_02q04_03","q02_02q04_02","q02_02q04_01","q02_02q03_03","q02_02q03_02","q02_02q03_01","q02_01q06_06","q02_01q06_05","q02_01q06_04","q02_01q06_03","q02_01q06_02","q02_01q06_01","q02_01q05_05","q02_01q05_04","q02_01q05_03","q02_01q05_02","q02_01q05_01","q02_01q04_04","q02_01q04_03","q02_01q04_02","q02_01q04_01","q02_01q03_03","q02_01q03_02","q02_01q03_01","q02_01q02_02","q01_01q06_06","q01_01q06_05","q01_01q06_04","q01_01q06_03","q01_01q06_02","q01_01q06_01","q01_01q05_05","q01_01q05_04","q01_01q05_03","q01_01q05_02","q01_01q05_01","q01_01q04_04","q01_01q04_03","q01_01q04_02","q01_01q04_01","q01_01q03_03","q01_01q03_02","q01_01q03_01","q01_01q02_02","q01_01q02_01","q01_01_12","q01_01_11","q01_01_10","q06_06_2","q06_05_2","q06_04_2","q06_03_2","q06_02_2","q06_01_2","q05_05_2","q05_04_2","q05_03_2","q05_02_2","q05_01_2","q04_04_2","q04_03_2","q04_02_2","q04_01_2","q03_03_4","q03_03_3","q03_03_2","q03_02_4","q03_02_3","q03_02_2","q03_01_4","q03_01_3","q03_01_2","q02_02_6","q02_02_5","q02_02_4","q02_02_3","q02_02_2","q02_01_6","q02_01_5","q02_01_4","q02_01_3","q02_01_2","q01_01_9","q01_01_8","q01_01_7","q01_01_6","q01_01_5","q01_01_4","q01_01_3","q01_01_2","q06_06","q06_05","q06_04","q06_03","q06_02","q06_01","q05_05","q05_04","q05_03","q05_02","q05_01","q04_04","q04_03","q04_02","q04_01","q03_03","q03_02","q03_01","q02_02","q02_01","q01_01"};
+    TermSpec _spec;
+    int _nTerms;
+    int _iShard;
+    int _nShards;
+    std::vector<Double_t> _q; // packed q_{r,s}, see TermSpec::QIndex
+    std::vector<int> _plan;
+    //accumulators are kept as [multBin][term] rows of (sum, sum of squares),
+    //a row is only allocated once its bin gets an event
+    //bin 0 and _nMultBin+1 are under- and overflow, as in TProfile
+    std::vector<std::vector<Double_t> > _rows;
+    //the q's of full events wait per bin until kPending of them are there,
+    //then their terms are computed together and the row is read and written
+    //once for all of them (a row is 360 kB at order 8), see FlushBin
+    static const int kPending = 16;
+    std::vector<std::vector<Double_t> > _pending; // [q][event] of every bin
+    std::vector<int> _nPending;
+    std::vector<Double_t> _tb; // term values of the pending events, [term][event]
+    std::vector<Double_t> _entries;
+    //events without tracks only count in _entries, single-track events are
+    //kept per bin as (sum u^S, sum +-u^S), u = 1/eff, see Store
+    std::vector<std::vector<Double_t> > _single;
+    std::vector<int> _termS;
+    std::vector<int> _termOdd;
+    int _nSinglePow;
+    int _nTrack; // tracks read for the current event
+    long long _inputOffset;
+    std::string _ckName;
+    long long _ckEvents;
+    double _ckSeconds;
+    long long _ckLastOffset;
+    std::chrono::steady_clock::time_point _ckLastTime;
+    Loader* _ckSnapshot; // copy of the accumulators being written
+    std::thread* _ckThread;
+    std::atomic<bool> _ckBusy;
+    FILE* _qDump;
+    void Init();
+    void Fill(int, const Double_t*, int);
+    void Push(int, const Double_t*);
+    void FlushBin(int);
+    void Flush();
+    //MultiLoader writes the snapshots of its three Loaders into one checkpoint
+    friend class MultiLoader;
+    void TakeSnapshot();
+    void Clear();
+    void WriteCheckpoint(std::string);
+    void WaitCheckpoint();
+    static void AddRow(std::vector<Double_t>&, const std::vector<Double_t>&);
+    int FindBin(int) const;
+    void GetCell(int, int, Double_t*) const;
+    TProfile* MakeProfile(int) const;
+    std::set<std::string> ProfileNames(TDirectory*) const;
+    bool ReadProfiles(TDirectory*, const std::set<std::string>&);
+    void Write(TDirectory*, int) const;
+    void WriteBinary(FILE*) const;
 };
 
 
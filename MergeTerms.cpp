@@ -0,0 +1,153 @@
+/*
+    Merge the terms files of many jobs into one.
+
+    Every thread sums a contiguous chunk of the file list into its own
+    Loaders, one file at a time, then the threads are merged pairwise
+    (tree reduction). Memory is one set of accumulators per thread,
+    whatever the number of files, and for a given number of threads the
+    result does not depend on the scheduling.
+    Input files can be TProfile or binary terms files, or both.
+    The output is a binary terms file when its name does not end in .root.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+
+#include "TROOT.h"
+#include "TFile.h"
+#include "Loader.h"
+#include "TermFile.h"
+
+using std::vector;
+using std::string;
+
+const int nType = 3;
+const char* typeNames[nType] = {"Pro", "Pbar", "Netp"};
+
+int main(int argc, char** argv){
+    if (argc < 3) {
+        std::cout << "[ERROR] Should have at least 2 arguments!\n";
+        std::cout << " - Usage: ./mergeTerms OUTNAME FILE_LIST [N_THREADS=4] [MAX_MULT=2000] [MAX_ORDER=6]\n";
+        return 1;
+    }
+    const char* outName = argv[1];
+    int nThreads = argc > 3 ? atoi(argv[3]) : 4;
+    const int MaxMult = argc > 4 ? atoi(argv[4]) : 2000;
+    const int MaxOrder = argc > 5 ? atoi(argv[5]) : 6;
+
+    vector<string> filelist;
+    string tmpStr;
+    std::ifstream rfilelist;
+    rfilelist.open(argv[2]);
+    while(std::getline(rfilelist, tmpStr)) {
+        if (!tmpStr.empty()) {
+            filelist.push_back(tmpStr);
+        }
+    }
+    const int nFiles = filelist.size();
+    if (nFiles == 0) {
+        std::cout << "[ERROR] No files in " << argv[2] << ".\n";
+        return 1;
+    }
+    if (nThreads < 1) {
+        nThreads = 1;
+    }
+    if (nThreads > nFiles) {
+        nThreads = nFiles;
+    }
+    std::cout << "[LOG] Merging " << nFiles << " files with " << nThreads << " threads.\n";
+    ROOT::EnableThreadSafety();
+
+    // one set of Loaders per thread
+    vector<vector<Loader*> > loaders(nThreads);
+    for (int t=0; t<nThreads; t++){
+        for (int i=0; i<nType; i++){
+            loaders[t].push_back(new Loader(typeNames[i], MaxMult, MaxOrder));
+        }
+    }
+
+    // stage 1, every thread adds its chunk of files
+    vector<int> nBad(nThreads, 0);
+    vector<std::thread> workers;
+    for (int t=0; t<nThreads; t++){
+        workers.push_back(std::thread([&, t](){
+            for (int f=(long long)nFiles*t/nThreads; f<(long long)nFiles*(t+1)/nThreads; f++){
+                // every file is opened once for the three particle types
+                const char* name = filelist[f].c_str();
+                if (TermFile::IsTermFile(name)){
+                    TermFile in(name);
+                    for (int i=0; i<nType; i++){
+                        if (!loaders[t][i]->ReadBinary(in)){
+                            nBad[t]++;
+                        }
+                    }
+                    continue;
+                }
+                TFile* in = new TFile(name);
+                if (in->IsZombie()){
+                    std::cout << "[ERROR] Cannot open terms file " << name << ".\n";
+                    nBad[t] += nType;
+                    delete in;
+                    continue;
+                }
+                for (int i=0; i<nType; i++){
+                    if (!loaders[t][i]->Add(in)){
+                        nBad[t]++;
+                    }
+                }
+                in->Close();
+                delete in;
+            }
+        }));
+    }
+    for (int t=0; t<nThreads; t++){
+        workers[t].join();
+    }
+
+    // stage 2, merge pairs of threads until one is left
+    for (int step=1; step<nThreads; step*=2){
+        workers.clear();
+        for (int t=0; t+step<nThreads; t+=2*step){
+            workers.push_back(std::thread([&, t, step](){
+                for (int i=0; i<nType; i++){
+                    loaders[t][i]->Merge(*loaders[t+step][i]);
+                    delete loaders[t+step][i];
+                    loaders[t+step][i] = 0;
+                }
+            }));
+        }
+        for (size_t w=0; w<workers.size(); w++){
+            workers[w].join();
+        }
+    }
+
+    int nBadAll = 0;
+    for (int t=0; t<nThreads; t++){
+        nBadAll += nBad[t];
+    }
+    if (nBadAll > 0){
+        std::cout << "[WARNING] " << nBadAll << " (file, particle type) pairs could not be read, see above.\n";
+    }
+
+    std::cout << "[LOG] Saving to " << outName << ".\n";
+    string out(outName);
+    bool isRoot = out.size() >= 5 && out.compare(out.size()-5, 5, ".root") == 0;
+    for (int i=0; i<nType; i++){
+        if (isRoot){
+            if (i == 0) loaders[0][i]->Save(outName);
+            else loaders[0][i]->Update(outName);
+        } else {
+            if (i == 0) loaders[0][i]->SaveBinary(outName);
+            else loaders[0][i]->UpdateBinary(outName);
+        }
+        delete loaders[0][i];
+    }
+
+    std::cout << "[LOG] All done!.\n";
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <iostream>
+#include <vector>
+#include <cstring>
+
+#include "TFile.h"
+#include "TKey.h"
+#include "TList.h"
+#include "TProfile.h"
+#include "ECorr.h"
+#include "MultiECorr.h"
+
+const char* MultiECorr::typeNames[MultiECorr::nType] = {"Pro", "Pbar", "Netp"};
+
+MultiECorr::MultiECorr(int MaxMult, int LowEventCut, int MaxOrder){
+  for(int i=0; i<nType; ++i){
+    _ecorr[i] = new ECorr(typeNames[i], MaxMult, LowEventCut, MaxOrder);
+  }
+  _file = 0;
+}
+
+MultiECorr::~MultiECorr(){
+  for(int i=0; i<nType; ++i){
+    delete _ecorr[i];
+  }
+  delete _file;
+}
+
+void MultiECorr::SetMultRange(int LowMult, int HighMult){
+  for(int i=0; i<nType; ++i){
+    _ecorr[i]->SetMultRange(LowMult, HighMult);
+  }
+}
+
+void MultiECorr::SetMultRange(CentDefinition& cDef, int LowMultCut){
+  for(int i=0; i<nType; ++i){
+    _ecorr[i]->SetMultRange(cDef, LowMultCut);
+  }
+}
+
+void MultiECorr::Init(){
+  for(int i=0; i<nType; ++i){
+    _ecorr[i]->Init();
+  }
+}
+
+bool MultiECorr::ReadTerms(const char* FileName){
+  //the terms of a previous file are dropped first, also if this one
+  //cannot be read
+  for(int i=0; i<nType; ++i){
+    _ecorr[i]->ClearTerms();
+  }
+  delete _file;
+  _file = 0;
+  if(TermFile::IsTermFile(FileName)){
+    _file = new TermFile(FileName);
+    bool ok = _file->IsOpen();
+    for(int i=0; i<nType && ok; ++i){
+      _ecorr[i]->ReadTerms(*_file);
+      ok = _ecorr[i]->_termsRead;
+    }
+    return ok;
+  }
+  TFile* tf = new TFile(FileName);
+  if(tf->IsZombie()){
+    std::cout << "[ERROR] Cannot open terms file " << FileName << ".\n";
+    delete tf;
+    return false;
+  }
+  //one pass over the key names: "<type>_<term>", highest cycle only,
+  //terms above MaxOrder are not read at all
+  std::vector<TKey*> keys[nType];
+  for(int i=0; i<nType; ++i){
+    keys[i].assign(_ecorr[i]->GetSpec().GetNTerms(), (TKey*)0);
+  }
+  TIter next(tf->GetListOfKeys());
+  TKey* key;
+  while((key = (TKey*)next())){
+    if(strcmp(key->GetClassName(), "TProfile") != 0){ continue; }
+    const char* name = key->GetName();
+    const char* sep = strchr(name, '_');
+    if(!sep){ continue; }
+    for(int i=0; i<nType; ++i){
+      if(strlen(typeNames[i]) != (size_t)(sep-name) || strncmp(name, typeNames[i], sep-name) != 0){ continue; }
+      int term = _ecorr[i]->GetSpec().FindTerm(sep+1);
+      if(term >= 0 && (!keys[i][term] || keys[i][term]->GetCycle() < key->GetCycle())){
+        keys[i][term] = key;
+      }
+    }
+  }
+  bool ok = true;
+  for(int i=0; i<nType; ++i){
+    for(size_t term=0; term<keys[i].size(); ++term){
+      if(!keys[i][term]){ continue; }
+      TProfile* p = dynamic_cast<TProfile*>(keys[i][term]->ReadObj());
+      if(!p){ continue; }
+      _ecorr[i]->ReadProfile(term, p);
+      delete p;
+    }
+    if(!_ecorr[i]->CheckTerms(FileName)){ ok = false; }
+  }
+  tf->Close();
+  delete tf;
+  return ok;
+}
+
+void MultiECorr::Calculate(int nThreads){
+  //the three are calculated together: their blocks of bins share one pool
+  //of threads, the histograms are filled afterwards
+  std::vector<ECorr*> ecorr;
+  std::vector<ECorr::Job> jobs(nType);
+  for(int i=0; i<nType; ++i){
+    if(_ecorr[i]->Prepare(jobs[ecorr.size()])){
+      ecorr.push_back(_ecorr[i]);
+    }
+  }
+  jobs.resize(ecorr.size());
+  ECorr::Run(ecorr, jobs, nThreads);
+  for(size_t i=0; i<ecorr.size(); ++i){
+    ecorr[i]->Finish(jobs[i]);
+  }
+}
+
+void MultiECorr::Write(const char* OutName, const char* option){
+  TFile* out = new TFile(OutName, option);
+  for(int i=0; i<nType; ++i){
+    _ecorr[i]->Write(out);
+  }
+  out->Close();
+  delete out;
+}
+
+void MultiECorr::Save(const char* OutName){
+  Write(OutName, "recreate");
+}
+
+void MultiECorr::Update(const char* OutName){
+  Write(OutName, "update");
+}
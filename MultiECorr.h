@@ -0,0 +1,38 @@
+#ifndef MULTIECORR_H
+#define MULTIECORR_H
+
+#include "Rtypes.h"
+
+class ECorr;
+class TermFile;
+class CentDefinition;
+
+//MultiECorr calculates "Pro", "Pbar" and "Netp" from one terms file.
+//The file is opened once and its keys are scanned once, every profile goes
+//to the ECorr of its particle type, and the histograms of all three are
+//written to the output file in one go.
+
+class MultiECorr {
+
+  public:
+    MultiECorr(int, int, int MaxOrder = 6);
+    ~MultiECorr();
+    void SetMultRange(int, int);
+    void SetMultRange(CentDefinition&, int LowMultCut = 0);
+    void Init();
+    bool ReadTerms(const char*); // false unless all three have their terms
+    void Calculate(int nThreads = 1); // all three at once, in one pool of threads
+    void Save(const char*);
+    void Update(const char*);
+    ECorr* GetECorr(int iType) { return _ecorr[iType]; } // 0 Pro, 1 Pbar, 2 Netp
+
+  private:
+    static const int nType = 3;
+    static const char* typeNames[nType];
+    ECorr* _ecorr[nType];
+    TermFile* _file; // binary terms file, shared by the three
+
+    void Write(const char*, const char*);
+};
+
+#endif
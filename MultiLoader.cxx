@@ -0,0 +1,274 @@
+#include "MultiLoader.h"
+#include "Loader.h"
+#include "TermFile.h"
+
+#include <iostream>
+#include <cstdio>
+
+const char* MultiLoader::typeNames[MultiLoader::nType] = {"Pro", "Pbar", "Netp"};
+
+MultiLoader::MultiLoader(int MaxMult, int MaxOrder){
+  for(int i=0; i<nType; ++i){
+    _loader[i] = new Loader(typeNames[i], MaxMult, MaxOrder);
+    _q[i].assign(_loader[i]->GetSpec().GetNq(), 0);
+    _nTrack[i] = 0;
+  }
+  _maxOrder = _loader[0]->GetSpec().GetMaxOrder();
+  _pro.assign(_maxOrder+1, 0);
+  _pbar.assign(_maxOrder+1, 0);
+  _ckEvents = 0;
+  _ckSeconds = 0;
+  _ckLastOffset = 0;
+  _ckThread = 0;
+  _ckBusy = false;
+}
+
+MultiLoader::MultiLoader(const MultiLoader& proto, int iShard, int nShards){
+  for(int i=0; i<nType; ++i){
+    _loader[i] = new Loader(*proto._loader[i], iShard, nShards);
+    _q[i].assign(_loader[i]->GetSpec().GetNq(), 0);
+    _nTrack[i] = 0;
+  }
+  _maxOrder = proto._maxOrder;
+  _pro.assign(_maxOrder+1, 0);
+  _pbar.assign(_maxOrder+1, 0);
+  _ckEvents = 0;
+  _ckSeconds = 0;
+  _ckLastOffset = 0;
+  _ckThread = 0;
+  _ckBusy = false;
+}
+
+MultiLoader::~MultiLoader(){
+  WaitCheckpoint();
+  for(int i=0; i<nType; ++i){
+    delete _loader[i];
+  }
+}
+
+void MultiLoader::ReadTrack(float charge, float eff){
+
+  ReadTracks(&charge, &eff, 1);
+
+}
+
+void MultiLoader::ReadTracks(const float* charge, const float* eff, int nTracks){
+
+  ReadTracks(charge, eff, nTracks, 1);
+
+}
+
+void MultiLoader::ReadTrackPairs(const float* pairs, int nTracks){
+
+  ReadTracks(pairs, pairs+1, nTracks, 2);
+
+}
+
+void MultiLoader::ReadTracks(const float* charge, const float* eff, int nTracks, int stride){
+
+  for(int k=0; k<nTracks*stride; k+=stride){
+    if(charge[k] == 0){ continue; }
+    Double_t* sum = charge[k] > 0 ? &_pro[0] : &_pbar[0];
+    _nTrack[charge[k] > 0 ? 0 : 1] += 1;
+    Double_t u = 1.0 / eff[k];
+    Double_t ie = u;
+    for(int s=1; s<=_maxOrder; ++s){
+      sum[s] += ie;
+      ie *= u;
+    }
+  }
+
+}
+
+void MultiLoader::Store(int RefMult){
+
+  const TermSpec& spec = _loader[0]->GetSpec();
+  for(int r=1; r<=_maxOrder; ++r){
+    for(int s=1; s<=r; ++s){
+      int k = spec.QIndex(r, s);
+      _q[0][k] = _pro[s];
+      _q[1][k] = _pbar[s];
+      _q[2][k] = r % 2 ? _pro[s] - _pbar[s] : _pro[s] + _pbar[s];
+    }
+  }
+  _nTrack[2] = _nTrack[0] + _nTrack[1];
+  for(int i=0; i<nType; ++i){
+    _loader[i]->Store(RefMult, &_q[i][0], _nTrack[i]);
+    _nTrack[i] = 0;
+  }
+  for(int s=0; s<=_maxOrder; ++s){
+    _pro[s] = 0;
+    _pbar[s] = 0;
+  }
+  if(_ckName.empty()){ return; }
+  long long offset = _loader[0]->GetInputOffset();
+  bool due = _ckEvents > 0 && offset - _ckLastOffset >= _ckEvents;
+  if(!due && _ckSeconds > 0){
+    due = std::chrono::duration<double>(std::chrono::steady_clock::now() - _ckLastTime).count() >= _ckSeconds;
+  }
+  if(due && _ckBusy){ due = false; } // the previous one is still being written
+  if(due){
+    //all three at the same event, so they resume from the same offset
+    WaitCheckpoint();
+    for(int i=0; i<nType; ++i){
+      _loader[i]->TakeSnapshot();
+    }
+    _ckBusy = true;
+    _ckThread = new std::thread(&MultiLoader::WriteCheckpoint, this, _ckName);
+    _ckLastOffset = offset;
+    _ckLastTime = std::chrono::steady_clock::now();
+  }
+
+}
+
+void MultiLoader::WriteCheckpoint(std::string FileName){
+
+  //the three sections go into one file under a temporary name, which is
+  //renamed once complete, so a killed job leaves either the previous or the
+  //new checkpoint of all three
+  std::string tmp = FileName + ".tmp";
+  FILE* out = fopen(tmp.c_str(), "wb");
+  if(!out){
+    std::cout << "[ERROR] Cannot write checkpoint " << tmp << ".\n";
+    _ckBusy = false;
+    return;
+  }
+  for(int i=0; i<nType; ++i){
+    Loader* snapshot = _loader[i]->_ckSnapshot;
+    snapshot->Flush();
+    snapshot->WriteBinary(out);
+  }
+  bool ok = fclose(out) == 0;
+  if(!ok || rename(tmp.c_str(), FileName.c_str()) != 0){
+    std::cout << "[ERROR] Cannot write checkpoint " << FileName << ".\n";
+  }
+  _ckBusy = false;
+}
+
+void MultiLoader::WaitCheckpoint(){
+
+  if(_ckThread){
+    _ckThread->join();
+    delete _ckThread;
+    _ckThread = 0;
+  }
+}
+
+void MultiLoader::SetCheckpoint(const char* FileName, long long nEvents, double seconds){
+
+  //one checkpoint file with a section per particle type
+  _ckName = FileName ? FileName : "";
+  _ckEvents = nEvents;
+  _ckSeconds = seconds;
+  _ckLastOffset = _loader[0]->GetInputOffset();
+  _ckLastTime = std::chrono::steady_clock::now();
+}
+
+void MultiLoader::SetInputOffset(long long offset){
+  for(int i=0; i<nType; ++i){
+    _loader[i]->SetInputOffset(offset);
+  }
+}
+
+long long MultiLoader::Resume(const char* FileName){
+
+  //the offsets of the three sections are checked before any is added, so a
+  //bad checkpoint leaves the Loaders empty
+  FILE* in = fopen(FileName, "rb");
+  if(!in){
+    std::cout << "[LOG] No checkpoint " << FileName << ", starting from the beginning.\n";
+    return 0;
+  }
+  fclose(in);
+  long long offset[nType];
+  bool ok = true;
+  {
+    TermFile file(FileName);
+    for(int i=0; i<nType; ++i){
+      TermFile::Section sec;
+      if(!file.IsOpen() || !file.FindSection(typeNames[i], sec)){
+        ok = false;
+        break;
+      }
+      offset[i] = sec.head->offset;
+      if(offset[i] != offset[0]){ ok = false; }
+    }
+  }
+  if(!ok){
+    std::cout << "[ERROR] Checkpoint " << FileName << " is incomplete or its sections have different input offsets, starting from the beginning.\n";
+    return 0;
+  }
+  for(int i=0; i<nType && ok; ++i){
+    ok = _loader[i]->Resume(FileName) == offset[0];
+  }
+  if(!ok){
+    std::cout << "[ERROR] Cannot resume from " << FileName << ", starting from the beginning.\n";
+    for(int i=0; i<nType; ++i){
+      _loader[i]->Clear();
+    }
+    return 0;
+  }
+  _ckLastOffset = offset[0];
+  return offset[0];
+}
+
+void MultiLoader::SetQDump(const char* FileName){
+
+  //one dump per particle type, FileName.Pro etc.
+  for(int i=0; i<nType; ++i){
+    _loader[i]->SetQDump(FileName ? (std::string(FileName) + "." + typeNames[i]).c_str() : 0);
+  }
+}
+
+long long MultiLoader::Replay(const char* FileName, int nThreads){
+
+  long long nEvents = 0;
+  for(int i=0; i<nType; ++i){
+    nEvents = _loader[i]->Replay((std::string(FileName) + "." + typeNames[i]).c_str(), nThreads);
+  }
+  return nEvents;
+}
+
+bool MultiLoader::Accepts(int RefMult) const {
+  return _loader[0]->Accepts(RefMult);
+}
+
+void MultiLoader::Merge(const MultiLoader& other){
+  for(int i=0; i<nType; ++i){
+    _loader[i]->Merge(*other._loader[i]);
+  }
+}
+
+void MultiLoader::Save(const char* OutName){
+
+  _loader[0]->Save(OutName);
+  for(int i=1; i<nType; ++i){
+    _loader[i]->Update(OutName);
+  }
+
+}
+
+void MultiLoader::Update(const char* OutName){
+
+  for(int i=0; i<nType; ++i){
+    _loader[i]->Update(OutName);
+  }
+
+}
+
+void MultiLoader::SaveBinary(const char* OutName){
+
+  _loader[0]->SaveBinary(OutName);
+  for(int i=1; i<nType; ++i){
+    _loader[i]->UpdateBinary(OutName);
+  }
+
+}
+
+void MultiLoader::UpdateBinary(const char* OutName){
+
+  for(int i=0; i<nType; ++i){
+    _loader[i]->UpdateBinary(OutName);
+  }
+
+}
@@ -0,0 +1,63 @@
+#ifndef MULTILOADER_H
+#define MULTILOADER_H
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include "Rtypes.h"
+
+class Loader;
+
+//MultiLoader fills "Pro", "Pbar" and "Netp" from a single track loop.
+//Protons and antiprotons count with unit weight, so their q_{r,s} only
+//depend on s: one sum of 1/eff^s per species and track. The net-proton
+//q's are built per event as q^pro_{r,s} + (-1)^r q^pbar_{r,s}.
+//Shards and Merge work as for Loader.
+
+class MultiLoader {
+
+  public:
+    MultiLoader(int, int MaxOrder = 6);
+    MultiLoader(const MultiLoader&, int, int); // empty shard iShard of nShards
+    ~MultiLoader();
+    void ReadTrack(float, float); // charge (> 0 proton, < 0 antiproton), eff
+    void ReadTracks(const float*, const float*, int);
+    void ReadTrackPairs(const float*, int); // (charge, eff) pairs, as in the packed event file
+    void Store(int);
+    void Save(const char*);
+    void Update(const char*);
+    void SaveBinary(const char*); // binary terms file, see TermFile.h
+    void UpdateBinary(const char*);
+    bool Accepts(int) const;
+    void SetCheckpoint(const char*, long long nEvents, double seconds = 0); // one file for all three, see Loader
+    void SetInputOffset(long long);
+    long long Resume(const char*);
+    void SetQDump(const char*); // see Loader
+    long long Replay(const char*, int nThreads = 1);
+    void Merge(const MultiLoader&);
+    Loader* GetLoader(int iType) { return _loader[iType]; } // 0 Pro, 1 Pbar, 2 Netp
+
+  private:
+    static const int nType = 3;
+    static const char* typeNames[nType];
+    Loader* _loader[nType];
+    int _maxOrder;
+    std::vector<Double_t> _pro; // sum of 1/eff^s, s = 1 .. _maxOrder
+    std::vector<Double_t> _pbar;
+    std::vector<Double_t> _q[nType]; // packed q_{r,s} handed to each Loader
+    int _nTrack[nType]; // tracks of the current event, per species
+    std::string _ckName;
+    long long _ckEvents;
+    double _ckSeconds;
+    long long _ckLastOffset;
+    std::chrono::steady_clock::time_point _ckLastTime;
+    std::thread* _ckThread;
+    std::atomic<bool> _ckBusy;
+    void WriteCheckpoint(std::string);
+    void WaitCheckpoint();
+    void ReadTracks(const float*, const float*, int, int);
+};
+
+#endif
@@ -0,0 +1,28 @@
+/*
+    Convert an event file (TTree "events" or columnar binary, see
+    EventSource.h) to the packed binary format, which fillTerms maps
+    and reads in place.
+*/
+
+#include <iostream>
+
+#include "EventSource.h"
+
+int main(int argc, char** argv){
+    if (argc != 3) {
+        std::cout << "[ERROR] Should have 2 arguments!\n";
+        std::cout << " - Usage: ./packEvents EVENT_FILE OUTNAME\n";
+        return 1;
+    }
+    EventSource* src = EventSource::Open(argv[1]);
+    if (!src) {
+        return 1;
+    }
+    std::cout << "[LOG] Converting " << argv[1] << " to " << argv[2] << ".\n";
+    long long nEvents = PackedSource::Write(argv[2], *src);
+    delete src;
+    std::cout << "[LOG] " << nEvents << " events written.\n";
+    std::cout << "[LOG] All done!.\n";
+
+    return 0;
+}
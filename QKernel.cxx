@@ -0,0 +1,138 @@
+#include "QKernel.h"
+#include "TermSpec.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define QKERNEL_X86
+#endif
+
+//The order is a template parameter so the power and accumulator loops are
+//fully unrolled, one instance per order.
+
+template<int N>
+static void ScalarKernel(const float* Particle, const float* eff, int nTracks, double* q){
+  for(int i=0; i<nTracks; ++i){
+    double pw[N+1], ie[N+1];
+    pw[1] = Particle[i];
+    ie[1] = 1.0 / eff[i];
+    for(int r=2; r<=N; ++r){
+      pw[r] = pw[r-1] * pw[1];
+      ie[r] = ie[r-1] * ie[1];
+    }
+    int k = 0;
+    for(int r=1; r<=N; ++r){
+      for(int s=1; s<=r; ++s){
+        q[k++] += pw[r] * ie[s];
+      }
+    }
+  }
+}
+
+#ifdef QKERNEL_X86
+
+//4 tracks per lane group, 1/eff and the powers are computed in double
+template<int N>
+__attribute__((target("avx2,fma")))
+static void AVX2Kernel(const float* Particle, const float* eff, int nTracks, double* q){
+  const int nq = N*(N+1)/2;
+  __m256d acc[nq];
+  for(int k=0; k<nq; ++k){
+    acc[k] = _mm256_setzero_pd();
+  }
+  const __m256d one = _mm256_set1_pd(1.0);
+  int i = 0;
+  for(; i+4<=nTracks; i+=4){
+    __m256d pw[N+1], ie[N+1];
+    pw[1] = _mm256_cvtps_pd(_mm_loadu_ps(Particle+i));
+    ie[1] = _mm256_div_pd(one, _mm256_cvtps_pd(_mm_loadu_ps(eff+i)));
+    for(int r=2; r<=N; ++r){
+      pw[r] = _mm256_mul_pd(pw[r-1], pw[1]);
+      ie[r] = _mm256_mul_pd(ie[r-1], ie[1]);
+    }
+    int k = 0;
+    for(int r=1; r<=N; ++r){
+      for(int s=1; s<=r; ++s){
+        acc[k] = _mm256_fmadd_pd(pw[r], ie[s], acc[k]);
+        ++k;
+      }
+    }
+  }
+  for(int k=0; k<nq; ++k){
+    double lane[4];
+    _mm256_storeu_pd(lane, acc[k]);
+    q[k] += (lane[0] + lane[1]) + (lane[2] + lane[3]);
+  }
+  ScalarKernel<N>(Particle+i, eff+i, nTracks-i, q);
+}
+
+//8 tracks per lane group
+template<int N>
+__attribute__((target("avx512f")))
+static void AVX512Kernel(const float* Particle, const float* eff, int nTracks, double* q){
+  const int nq = N*(N+1)/2;
+  __m512d acc[nq];
+  for(int k=0; k<nq; ++k){
+    acc[k] = _mm512_setzero_pd();
+  }
+  const __m512d one = _mm512_set1_pd(1.0);
+  int i = 0;
+  for(; i+8<=nTracks; i+=8){
+    __m512d pw[N+1], ie[N+1];
+    pw[1] = _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(Particle+i));
+    ie[1] = _mm512_div_pd(one, _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(eff+i)));
+    for(int r=2; r<=N; ++r){
+      pw[r] = _mm512_mul_pd(pw[r-1], pw[1]);
+      ie[r] = _mm512_mul_pd(ie[r-1], ie[1]);
+    }
+    int k = 0;
+    for(int r=1; r<=N; ++r){
+      for(int s=1; s<=r; ++s){
+        acc[k] = _mm512_fmadd_pd(pw[r], ie[s], acc[k]);
+        ++k;
+      }
+    }
+  }
+  for(int k=0; k<nq; ++k){
+    double lane[8];
+    _mm512_storeu_pd(lane, acc[k]);
+    q[k] += ((lane[0] + lane[1]) + (lane[2] + lane[3])) + ((lane[4] + lane[5]) + (lane[6] + lane[7]));
+  }
+  ScalarKernel<N>(Particle+i, eff+i, nTracks-i, q);
+}
+
+#endif
+
+typedef void (*KernelFunc)(const float*, const float*, int, double*);
+
+struct KernelSet {
+  const char* name;
+  KernelFunc func[TermSpec::kMaxOrder+1];
+};
+
+static const KernelSet kScalar = {"scalar", {0, ScalarKernel<1>, ScalarKernel<2>, ScalarKernel<3>, ScalarKernel<4>, ScalarKernel<5>, ScalarKernel<6>, ScalarKernel<7>, ScalarKernel<8>}};
+#ifdef QKERNEL_X86
+static const KernelSet kAVX2 = {"avx2", {0, AVX2Kernel<1>, AVX2Kernel<2>, AVX2Kernel<3>, AVX2Kernel<4>, AVX2Kernel<5>, AVX2Kernel<6>, AVX2Kernel<7>, AVX2Kernel<8>}};
+static const KernelSet kAVX512 = {"avx512", {0, AVX512Kernel<1>, AVX512Kernel<2>, AVX512Kernel<3>, AVX512Kernel<4>, AVX512Kernel<5>, AVX512Kernel<6>, AVX512Kernel<7>, AVX512Kernel<8>}};
+#endif
+
+static const KernelSet* SelectKernels(){
+#ifdef QKERNEL_X86
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx512f")){ return &kAVX512; }
+  if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")){ return &kAVX2; }
+#endif
+  return &kScalar;
+}
+
+void AccumulateQ(int MaxOrder, const float* Particle, const float* eff, int nTracks, double* q){
+  static const KernelSet* kernels = SelectKernels();
+  kernels->func[MaxOrder](Particle, eff, nTracks, q);
+}
+
+void AccumulateQScalar(int MaxOrder, const float* Particle, const float* eff, int nTracks, double* q){
+  kScalar.func[MaxOrder](Particle, eff, nTracks, q);
+}
+
+const char* GetQKernelName(){
+  return SelectKernels()->name;
+}
@@ -0,0 +1,12 @@
+#ifndef QKERNEL_H
+#define QKERNEL_H
+
+//Accumulate q_{r,s} += Particle^r / eff^s over a batch of tracks, for
+//1 <= s <= r <= MaxOrder, into q packed as in TermSpec::QIndex.
+//AccumulateQ uses the widest vector kernel the CPU supports (AVX-512, AVX2),
+//checked once at run time, so the same binary runs on every node.
+void AccumulateQ(int MaxOrder, const float* Particle, const float* eff, int nTracks, double* q);
+void AccumulateQScalar(int MaxOrder, const float* Particle, const float* eff, int nTracks, double* q);
+const char* GetQKernelName();
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef RESULTTABLE_H
+#define RESULTTABLE_H
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <iostream>
+
+// Flat table of the cumulant results, one row per (species, observable, bin),
+// written next to the ROOT output so that many result files can be scanned
+// without ROOT.
+// A name ending in .csv gives a text table with the header line
+//   species,observable,bin,value,error,nEvents
+// any other name a binary one: ResultTableHeader, then nRows ResultRow.
+// bin is the multiplicity for raw results and the centrality index for CBWC.
+
+struct ResultTableHeader {
+    char magic[8]; // "CUMRES1"
+    long long nRows;
+};
+
+struct ResultRow {
+    char species[8];
+    char observable[8];
+    int bin;
+    int pad;
+    double value;
+    double error;
+    double nEvents;
+};
+
+class ResultTable{
+
+    private:
+        FILE* out;
+        bool csv;
+        ResultTableHeader head;
+
+    public:
+        ResultTable(const char* path){
+            std::string name(path);
+            csv = name.size() >= 4 && name.compare(name.size()-4, 4, ".csv") == 0;
+            out = fopen(path, csv ? "w" : "wb");
+            memset(&head, 0, sizeof(head));
+            memcpy(head.magic, Magic(), 8);
+            if (!out){
+                std::cout << "[ERROR] Cannot write result table " << path << ".\n";
+                return;
+            }
+            if (csv){
+                fprintf(out, "species,observable,bin,value,error,nEvents\n");
+            } else {
+                fwrite(&head, sizeof(head), 1, out);
+            }
+        }
+        ~ResultTable(){
+            Close();
+        }
+
+        bool IsOpen() const { return out != 0; }
+        static const char* Magic() { return "CUMRES1"; }
+
+        void Fill(const char* species, const char* observable, int bin, double value, double error, double nEvents){
+            if (!out){
+                return;
+            }
+            if (csv){
+                fprintf(out, "%s,%s,%d,%.17g,%.17g,%.17g\n", species, observable, bin, value, error, nEvents);
+            } else {
+                ResultRow row;
+                memset(&row, 0, sizeof(row));
+                strncpy(row.species, species, sizeof(row.species)-1);
+                strncpy(row.observable, observable, sizeof(row.observable)-1);
+                row.bin = bin;
+                row.value = value;
+                row.error = error;
+                row.nEvents = nEvents;
+                fwrite(&row, sizeof(row), 1, out);
+            }
+            head.nRows ++;
+        }
+
+        void Close(){
+            if (!out){
+                return;
+            }
+            if (!csv){
+                // the row count is known only now
+                fseek(out, 0, SEEK_SET);
+                fwrite(&head, sizeof(head), 1, out);
+            }
+            fclose(out);
+            out = 0;
+        }
+};
+
+#endif
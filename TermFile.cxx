@@ -0,0 +1,73 @@
+#include "TermFile.h"
+
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+TermFile::TermFile(const char* FileName) : _name(FileName), _data(0), _size(0){
+  int fd = open(FileName, O_RDONLY);
+  if(fd < 0){
+    std::cout << "[ERROR] Cannot open terms file " << FileName << ".\n";
+    return;
+  }
+  struct stat st;
+  if(fstat(fd, &st) == 0 && st.st_size > 0){
+    void* p = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(p != MAP_FAILED){
+      _data = (const char*)p;
+      _size = st.st_size;
+    }
+  }
+  close(fd);
+  if(!_data){
+    std::cout << "[ERROR] Cannot map terms file " << FileName << ".\n";
+  }
+}
+
+TermFile::~TermFile(){
+  if(_data){
+    munmap((void*)_data, _size);
+  }
+}
+
+bool TermFile::FindSection(const char* type, Section& sec) const {
+  bool found = false;
+  long long pos = 0;
+  while(_data && pos + (long long)sizeof(TermFileHeader) <= _size){
+    const TermFileHeader* head = (const TermFileHeader*)(_data + pos);
+    if(memcmp(head->magic, Magic(), 8) != 0 || head->size <= 0 || pos + head->size > _size){
+      std::cout << "[WARNING] Broken section in terms file, the rest is skipped.\n";
+      break;
+    }
+    if(strncmp(head->type, type, sizeof(head->type)) == 0){
+      const char* p = (const char*)(head + 1);
+      sec.head = head;
+      sec.names.clear();
+      const char* name = p;
+      for(int i=0; i<head->nTerms; ++i){
+        sec.names.push_back(name);
+        name += strlen(name) + 1;
+      }
+      p += head->nameBytes;
+      sec.bin = (const long long*)p;
+      sec.entries = (const double*)(sec.bin + head->nBins);
+      sec.sums = sec.entries + head->nBins;
+      found = true;
+    }
+    pos += head->size;
+  }
+  return found;
+}
+
+bool TermFile::IsTermFile(const char* FileName){
+  char magic[8];
+  FILE* f = fopen(FileName, "rb");
+  if(!f){ return false; }
+  bool ok = fread(magic, 1, 8, f) == 8 && memcmp(magic, Magic(), 8) == 0;
+  fclose(f);
+  return ok;
+}
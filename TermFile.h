@@ -0,0 +1,54 @@
+#ifndef TERMFILE_H
+#define TERMFILE_H
+
+#include <vector>
+#include <string>
+
+//Binary terms file, the alternative to the TProfile file of Loader::Save.
+//The file is a list of sections, one per particle type, each one
+//  TermFileHeader
+//  term names, '\0' separated, padded to 8 bytes (nameBytes)
+//  long long bin[nBins]       Loader bins, 0 underflow, mult+1, nMultBin+1 overflow
+//  double entries[nBins]
+//  double sums[nBins][nTerms][2]  (sum, sum of squares) of every term
+//Only bins with events are written. Numbers are in the native byte order.
+//TermFile maps the file read-only, so the sums are read in place.
+
+struct TermFileHeader {
+  char magic[8]; // "CUMTERM1"
+  char type[32];
+  int maxOrder;
+  int nTerms;
+  int nBins;
+  int nMultBin;
+  long long nameBytes;
+  long long size; // of the whole section, header included
+  long long offset; // input offset when written, used by checkpoints
+};
+
+class TermFile {
+
+  public:
+    struct Section {
+      const TermFileHeader* head;
+      std::vector<const char*> names;
+      const long long* bin;
+      const double* entries;
+      const double* sums;
+    };
+
+    TermFile(const char*);
+    ~TermFile();
+    bool IsOpen() const { return _data != 0; }
+    const char* GetName() const { return _name.c_str(); }
+    bool FindSection(const char*, Section&) const; // last section of the type
+    static bool IsTermFile(const char*);
+    static const char* Magic() { return "CUMTERM1"; }
+
+  private:
+    std::string _name;
+    const char* _data;
+    long long _size;
+};
+
+#endif
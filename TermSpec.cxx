@@ -0,0 +1,216 @@
+#include "TermSpec.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+
+TermSpec::TermSpec(int MaxOrder) : _maxOrder(MaxOrder){
+  if(_maxOrder < 1 || _maxOrder > kMaxOrder){
+    std::cout << "[WARNING] TermSpec supports order 1 to " << kMaxOrder << ", got " << MaxOrder << ".\n";
+    _maxOrder = _maxOrder < 1 ? 1 : kMaxOrder;
+  }
+  for(int r=1; r<=_maxOrder; ++r){
+    for(int s=1; s<=r; ++s){
+      _qr.push_back(r);
+      _qs.push_back(s);
+    }
+  }
+  _nq = _qr.size();
+
+  //basis: every product of q's with sum of r <= MaxOrder
+  std::vector<std::vector<int> > basis;
+  std::vector<int> e(_nq, 0);
+  AddBasis(basis, e, 0, 0);
+
+  //terms: the basis and all pairwise products of it
+  std::set<std::vector<int> > all(basis.begin(), basis.end());
+  for(size_t a=0; a<basis.size(); ++a){
+    for(size_t b=a; b<basis.size(); ++b){
+      for(int k=0; k<_nq; ++k){
+        e[k] = basis[a][k] + basis[b][k];
+      }
+      all.insert(e);
+    }
+  }
+
+  //order by number of factors, then by the factor list, so the prefix of
+  //a term (its last factor dropped) always comes before the term itself
+  std::vector<std::vector<int> > keys;
+  for(std::set<std::vector<int> >::const_iterator it=all.begin(); it!=all.end(); ++it){
+    std::vector<int> key(1, 0);
+    for(int k=0; k<_nq; ++k){
+      for(int p=0; p<(*it)[k]; ++p){
+        key.push_back(k);
+      }
+    }
+    key[0] = key.size()-1;
+    keys.push_back(key);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  for(size_t i=0; i<keys.size(); ++i){
+    std::vector<int> exps(_nq, 0);
+    for(size_t k=1; k<keys[i].size(); ++k){
+      exps[keys[i][k]] += 1;
+    }
+    int factor = keys[i].back();
+    int parent = -1;
+    if(keys[i][0] > 1){
+      exps[factor] -= 1;
+      parent = _index[exps];
+      exps[factor] += 1;
+    }
+    _index[exps] = i;
+    _exps.push_back(exps);
+    _names.push_back(MakeName(exps));
+    _parent.push_back(parent);
+    _factor.push_back(factor);
+  }
+
+  std::map<std::vector<int>, int> basisIndex;
+  for(size_t a=0; a<basis.size(); ++a){
+    basisIndex[basis[a]] = a;
+    _basis.push_back(_index[basis[a]]);
+  }
+  _product.resize(basis.size()*basis.size());
+  for(size_t a=0; a<basis.size(); ++a){
+    for(size_t b=0; b<basis.size(); ++b){
+      for(int k=0; k<_nq; ++k){
+        e[k] = basis[a][k] + basis[b][k];
+      }
+      _product[a*basis.size()+b] = _index[e];
+    }
+  }
+  BuildMoments(basisIndex);
+  BuildMomentProducts();
+}
+
+TermSpec::~TermSpec(){
+}
+
+void TermSpec::AddBasis(std::vector<std::vector<int> >& basis, std::vector<int>& e, int k, int order) const {
+  if(k == _nq){
+    if(order > 0){ basis.push_back(e); }
+    return;
+  }
+  for(int p=0; order+p*_qr[k]<=_maxOrder; ++p){
+    e[k] = p;
+    AddBasis(basis, e, k+1, order+p*_qr[k]);
+  }
+  e[k] = 0;
+}
+
+std::string TermSpec::MakeName(const std::vector<int>& exps) const {
+  std::string name;
+  char buf[32];
+  for(int k=0; k<_nq; ++k){
+    if(exps[k] == 0){ continue; }
+    if(exps[k] == 1){
+      snprintf(buf, sizeof(buf), "q%02d_%02d", _qr[k], _qs[k]);
+    } else {
+      snprintf(buf, sizeof(buf), "q%02d_%02d_%d", _qr[k], _qs[k], exps[k]);
+    }
+    name += buf;
+  }
+  return name;
+}
+
+int TermSpec::FindTerm(const std::vector<int>& exps) const {
+  std::map<std::vector<int>, int>::const_iterator it = _index.find(exps);
+  return it == _index.end() ? -1 : it->second;
+}
+
+int TermSpec::FindTerm(const char* name) const {
+  std::vector<int> exps(_nq, 0);
+  const char* c = name;
+  int r, s, p, n;
+  while(*c){
+    p = 1;
+    if(sscanf(c, "q%2d_%2d%n", &r, &s, &n) != 2){ return -1; }
+    if(r < 1 || r > _maxOrder || s < 1 || s > r){ return -1; }
+    c += n;
+    if(*c == '_'){
+      if(sscanf(c, "_%d%n", &p, &n) != 1){ return -1; }
+      c += n;
+    }
+    exps[QIndex(r, s)] += p;
+  }
+  return FindTerm(exps);
+}
+
+void TermSpec::BuildMoments(const std::map<std::vector<int>, int>& basisIndex){
+  //Track-by-track efficiency correction: expanding Q^k over set partitions of
+  //the k particle slots and correcting each distinct-particle sum gives
+  //  <Q^k> = B_k(w_1, ..., w_k), the complete Bell polynomial, with
+  //  w_g = sum_c S(g,c) (-1)^(c-1) (c-1)! q_{g,c}
+  //e.g. <Q^2> = <q_{1,1}^2 + q_{2,1} - q_{2,2}>.
+  typedef std::map<std::vector<int>, double> Poly;
+  int n = _maxOrder;
+  std::vector<std::vector<double> > stirling(n+1, std::vector<double>(n+1, 0)); // second kind
+  std::vector<std::vector<double> > binom(n+1, std::vector<double>(n+1, 0));
+  stirling[0][0] = 1;
+  for(int g=0; g<=n; ++g){
+    binom[g][0] = 1;
+    for(int c=1; c<=g; ++c){
+      stirling[g][c] = c*stirling[g-1][c] + stirling[g-1][c-1];
+      binom[g][c] = binom[g-1][c-1] + (c < g ? binom[g-1][c] : 0);
+    }
+  }
+  std::vector<Poly> w(n+1);
+  for(int g=1; g<=n; ++g){
+    double factorial = 1;
+    for(int c=1; c<=g; ++c){
+      std::vector<int> e(_nq, 0);
+      e[QIndex(g, c)] = 1;
+      w[g][e] = stirling[g][c] * (c % 2 ? 1 : -1) * factorial;
+      factorial *= c;
+    }
+  }
+  std::vector<Poly> bell(n+1);
+  bell[0][std::vector<int>(_nq, 0)] = 1;
+  for(int k=0; k<n; ++k){
+    for(int i=0; i<=k; ++i){
+      for(Poly::const_iterator a=bell[k-i].begin(); a!=bell[k-i].end(); ++a){
+        for(Poly::const_iterator b=w[i+1].begin(); b!=w[i+1].end(); ++b){
+          std::vector<int> e(a->first);
+          for(int q=0; q<_nq; ++q){
+            e[q] += b->first[q];
+          }
+          bell[k+1][e] += binom[k][i] * a->second * b->second;
+        }
+      }
+    }
+  }
+  _moment.assign(n+1, std::vector<std::pair<int, double> >());
+  for(int k=1; k<=n; ++k){
+    for(Poly::const_iterator it=bell[k].begin(); it!=bell[k].end(); ++it){
+      if(it->second == 0){ continue; }
+      _moment[k].push_back(std::make_pair(basisIndex.find(it->first)->second, it->second));
+    }
+  }
+}
+
+void TermSpec::BuildMomentProducts(){
+  //M_k M_l = sum_ab c_a c_b <a><b>, so the product of the estimators is
+  //sum_ab c_a c_b <ab>, collected by product term once for all bins
+  int n = _maxOrder;
+  _momentProduct.assign((n+1)*(n+1), std::vector<std::pair<int, double> >());
+  for(int k=1; k<=n; ++k){
+    for(int l=1; l<=n; ++l){
+      std::map<int, double> coef;
+      for(size_t a=0; a<_moment[k].size(); ++a){
+        for(size_t b=0; b<_moment[l].size(); ++b){
+          coef[GetProductTerm(_moment[k][a].first, _moment[l][b].first)] += _moment[k][a].second * _moment[l][b].second;
+        }
+      }
+      std::vector<std::pair<int, double> >& mp = _momentProduct[k*(n+1)+l];
+      for(std::map<int, double>::const_iterator it=coef.begin(); it!=coef.end(); ++it){
+        if(it->second != 0){
+          mp.push_back(*it);
+        }
+      }
+    }
+  }
+}
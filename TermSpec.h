@@ -0,0 +1,73 @@
+#ifndef TERMSPEC_H
+#define TERMSPEC_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+//TermSpec is the single source of the q_{r,s} products used by Loader and ECorr.
+//q_{r,s} = sum over tracks of Particle^r / eff^s, with 1 <= s <= r <= MaxOrder.
+//The basis is every product of q's with sum of r <= MaxOrder, which is enough
+//for the efficiency corrected moments up to MaxOrder. The terms are the basis
+//plus all pairwise products of basis entries, which ECorr needs for the
+//statistical errors. MaxOrder = 6 gives the 2535 terms, named as before,
+//e.g. q01_01_2q02_01 = q_{1,1}^2 q_{2,1}; 7 gives 7584 and 8 gives 22531.
+
+class TermSpec {
+
+  public:
+    static const int kMaxOrder = 8; // q_{r,s} are kept up to this order
+    TermSpec(int MaxOrder = 6);
+    ~TermSpec();
+
+    int GetMaxOrder() const { return _maxOrder; }
+    int GetNq() const { return _nq; }
+    int QIndex(int r, int s) const { return (r-1)*r/2 + s-1; } // packed (r,s)
+    int GetQr(int k) const { return _qr[k]; }
+    int GetQs(int k) const { return _qs[k]; }
+    int GetNTerms() const { return _names.size(); }
+    const char* GetName(int i) const { return _names[i].c_str(); }
+    const std::vector<int>& GetExponents(int i) const { return _exps[i]; }
+    int FindTerm(const std::vector<int>& exps) const;
+    int FindTerm(const char* name) const;
+
+    //terms are ordered by number of factors, the first GetNq() are the q's
+    //term i = term GetParent(i) * q[GetFactor(i)], GetParent(i) < i
+    int GetParent(int i) const { return _parent[i]; }
+    int GetFactor(int i) const { return _factor[i]; }
+
+    //basis entries and the term index of their products
+    int GetNBasis() const { return _basis.size(); }
+    int GetBasisTerm(int a) const { return _basis[a]; }
+    int GetProductTerm(int a, int b) const { return _product[a*_basis.size()+b]; }
+
+    //corrected raw moment <Q^k> = sum of coefficient * <basis entry>, k = 1 .. MaxOrder
+    const std::vector<std::pair<int, double> >& GetMoment(int k) const { return _moment[k]; }
+    //sum of coefficient * <term> for the product of the moment k and l estimators,
+    //cov(M_k, M_l) = (that - M_k M_l) / N, pairs of basis entries with the same
+    //product term merged, k, l = 1 .. MaxOrder
+    const std::vector<std::pair<int, double> >& GetMomentProduct(int k, int l) const { return _momentProduct[k*(_maxOrder+1)+l]; }
+
+  private:
+    int _maxOrder;
+    int _nq;
+    std::vector<int> _qr;
+    std::vector<int> _qs;
+    std::vector<std::vector<int> > _exps;
+    std::vector<std::string> _names;
+    std::vector<int> _parent;
+    std::vector<int> _factor;
+    std::map<std::vector<int>, int> _index;
+    std::vector<int> _basis;
+    std::vector<int> _product;
+    std::vector<std::vector<std::pair<int, double> > > _moment;
+    std::vector<std::vector<std::pair<int, double> > > _momentProduct;
+
+    void AddBasis(std::vector<std::vector<int> >&, std::vector<int>&, int, int) const;
+    std::string MakeName(const std::vector<int>&) const;
+    void BuildMoments(const std::map<std::vector<int>, int>&);
+    void BuildMomentProducts();
+};
+
+#endif
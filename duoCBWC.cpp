@@ -1,4 +1,7 @@
 /*
+    Optional TABLE argument csv or bin: the results are also written as a
+    flat table, OUTNAME.csv (OUTNAME.tab for bin), see ResultTable.h.
+
     Updated: Now read file lists (of input raw cumulants and centrality edges)
     Support up to 10 files.
 
@@ -23,14 +26,15 @@
 
 #include "NpartLoader.h"
 #include "CentDefinition.h"
+#include "ResultTable.h"
 
 using std::vector;
 using std::string;
 
 int main(int argc, char** argv){
-    if (argc != 4) {
+    if (argc != 4 && argc != 5) {
         std::cout << "[ERROR] Should have 3 arguments!\n";
-        std::cout << " - Usage: ./duoCBWC FILE_LIST CENT_LIST OUTNAME\n";
+        std::cout << " - Usage: ./duoCBWC FILE_LIST CENT_LIST OUTNAME [TABLE=csv|bin]\n";
     } else {
         std::cout << "[LOG] Input inforamtion: \n";
         std::cout << " - Terms file list: " << argv[1] << std::endl;
@@ -38,6 +42,16 @@ int main(int argc, char** argv){
         std::cout << "[LOG] Output file name: " << argv[3] << ".root" << std::endl;
     }
 
+    ResultTable* table = 0;
+    if (argc == 5) {
+        string fmt(argv[4]);
+        if (fmt != "csv" && fmt != "bin") {
+            std::cout << "[ERROR] Table format should be csv or bin, got " << argv[4] << ".\n";
+            return 1;
+        }
+        table = new ResultTable(Form("%s.%s", argv[3], fmt == "csv" ? "csv" : "tab"));
+    }
+
     vector<string> filelist;
     vector<string> centlist;
     TFile* tfs[10];
@@ -185,12 +199,15 @@ int main(int argc, char** argv){
                 // set points to graphes
                 tgs[i][j]->SetPoint(k, nPart[k], vSum[i][k]);
                 tgs[i][j]->SetPointError(k, 0.0, eSum[i][k]);
+                if (table){
+                    table->Fill(typeNames[i], cumNames[j], k, vSum[i][k], eSum[i][k], CentEvent[i][k]);
+                }
             }
         }
     }
 
     std::cout << "[LOG] Calculating finished, now saving.\n";
-    TFile* tfout = new TFile(Form("%s.root", argv[5]), "recreate");
+    TFile* tfout = new TFile(Form("%s.root", argv[3]), "recreate");
     tfout->cd();
     for (int i=0; i<nType; i++){
         for (int j=0; j<nCums; j++){
@@ -204,6 +221,7 @@ int main(int argc, char** argv){
         tfs[i]->Close();
     }
     tfout->Close();
+    delete table;
 
     std::cout << "[LOG] All done!.\n";
 